@@ -2,6 +2,7 @@
 #include "function.h"
 #include "pool.h"
 #include "charsequence.h"
+#include "kernel.h"
 #include <memory>
 #include <vector>
 #include <future>
@@ -22,6 +23,16 @@
 #include <stdexcept>
 #include <atomic>
 #include <type_traits>
+#include <cstdint>
+#include <cmath>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <mutex>
+#include <chrono>
+#include <iomanip>
+#include <cstdlib>
+#include <new>
 
 namespace collector
 {
@@ -31,7 +42,7 @@ template <typename A>
 using Identity = function::Supplier<A>;
 
 template <typename E, typename A>
-using Interrupt = function::TriPredicate<E, function::Timestamp, A>;
+using Interrupt = function::TriPredicate<E, function::Timestamp, const A &>;
 
 template <typename A, typename E>
 using Accumulator = function::TriFunction<A, E, function::Timestamp, A>;
@@ -42,115 +53,896 @@ using Combiner = function::BiFunction<A, A, A>;
 template <typename A, typename R>
 using Finisher = function::Function<A, R>;
 
+template <typename A, typename E>
+using Block = function::BiFunction<const E *, function::Module, A>;
+
+template <typename A>
+using Reserve = function::BiConsumer<A &, function::Module>;
+
+template <typename A>
+using Gather = function::BiFunction<std::vector<A>, pool::Executor &, A>;
+
 inline pool::ThreadPool &globalPool()
 {
     static pool::ThreadPool instance;
     return instance;
 }
 
-template <typename E, typename A, typename R>
-class Collector
+inline auto scopedExecutor() -> pool::Executor *&
+{
+    static thread_local pool::Executor *current = nullptr;
+    return current;
+}
+
+inline auto currentExecutor(pool::Executor *preferred = nullptr) -> pool::Executor &
+{
+    if (preferred != nullptr)
+    {
+        return *preferred;
+    }
+    if (scopedExecutor() != nullptr)
+    {
+        return *scopedExecutor();
+    }
+    if (pool::ThreadPool::current() != nullptr)
+    {
+        return *pool::ThreadPool::current();
+    }
+    return globalPool();
+}
+
+class ExecutorScope
 {
   private:
-    std::unique_ptr<Identity<A>> identity;
-    std::unique_ptr<Interrupt<E, A>> interrupt;
-    std::unique_ptr<Accumulator<A, E>> accumulator;
-    std::unique_ptr<Combiner<A>> combiner;
-    std::unique_ptr<Finisher<A, R>> finisher;
+    pool::Executor *previous;
 
-    template <typename Container>
-    auto group(const Container &container, const function::Module &concurrent) const -> std::vector<std::future<A>>
+  public:
+    explicit ExecutorScope(pool::Executor &executor) : previous(scopedExecutor())
+    {
+        scopedExecutor() = &executor;
+    }
+
+    ExecutorScope(const ExecutorScope &) = delete;
+    ExecutorScope &operator=(const ExecutorScope &) = delete;
+
+    ~ExecutorScope()
     {
-        std::atomic<bool> hasError{false};
-        std::vector<std::future<A>> futures;
-        futures.reserve(concurrent);
+        scopedExecutor() = previous;
+    }
+};
 
-        for (function::Module thread = 0; thread < concurrent; ++thread)
+inline auto allocations() -> std::uint64_t &
+{
+    static thread_local std::uint64_t count = 0;
+    return count;
+}
+
+class Profile
+{
+  public:
+    struct Row
+    {
+        std::string name;
+        const Row *upstream;
+        std::atomic<std::uint64_t> elements{0};
+        std::atomic<std::uint64_t> elapsed{0};
+        std::atomic<std::uint64_t> downstream{0};
+        std::atomic<std::uint64_t> allocated{0};
+        std::atomic<std::uint64_t> released{0};
+
+        Row(std::string name, const Row *upstream) : name(std::move(name)), upstream(upstream) {}
+
+        auto inclusive() const -> std::uint64_t
         {
-            futures.emplace_back(globalPool().submit<A>([this, &container, thread, concurrent, &hasError]() -> A {
-                A identityValue = (*identity)();
-                function::Module index = 0;
-                for (const E &element : container)
+            std::uint64_t total = elapsed.load(std::memory_order_relaxed);
+            std::uint64_t below = downstream.load(std::memory_order_relaxed);
+            return total > below ? total - below : 0;
+        }
+
+        auto exclusive() const -> std::uint64_t
+        {
+            std::uint64_t own = inclusive();
+            std::uint64_t above = upstream == nullptr ? 0 : upstream->inclusive();
+            return own > above ? own - above : 0;
+        }
+
+        auto allocations() const -> std::uint64_t
+        {
+            std::uint64_t total = allocated.load(std::memory_order_relaxed);
+            std::uint64_t below = released.load(std::memory_order_relaxed);
+            std::uint64_t own = total > below ? total - below : 0;
+            if (upstream == nullptr)
+            {
+                return own;
+            }
+            std::uint64_t above = upstream->allocated.load(std::memory_order_relaxed) - upstream->released.load(std::memory_order_relaxed);
+            return own > above ? own - above : 0;
+        }
+    };
+
+  private:
+    std::deque<Row> rows;
+    mutable std::mutex mutex;
+    std::ostream *sink;
+
+  public:
+    explicit Profile(std::ostream *sink = nullptr) : sink(sink) {}
+
+    Profile(const Profile &) = delete;
+    Profile &operator=(const Profile &) = delete;
+
+    ~Profile()
+    {
+        if (sink != nullptr)
+        {
+            *sink << *this;
+        }
+    }
+
+    auto stage(std::string name, const Row *upstream = nullptr) -> Row &
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return rows.emplace_back(std::move(name), upstream);
+    }
+
+    template <typename E>
+    static auto instrument(std::shared_ptr<Profile> profile, Row &row, function::Generator<E> generator) -> function::Generator<E>
+    {
+        return [profile = std::move(profile), &row, generator = std::move(generator)](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
+            std::uint64_t before = allocations();
+            pool::Clock::time_point start = pool::Clock::now();
+            generator(
+                [&row, &accept](E element, function::Timestamp index) -> void {
+                    row.elements.fetch_add(1, std::memory_order_relaxed);
+                    std::uint64_t before = allocations();
+                    pool::Clock::time_point start = pool::Clock::now();
+                    accept(element, index);
+                    row.downstream.fetch_add(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(pool::Clock::now() - start).count()), std::memory_order_relaxed);
+                    row.released.fetch_add(allocations() - before, std::memory_order_relaxed);
+                },
+                interrupt);
+            row.elapsed.fetch_add(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(pool::Clock::now() - start).count()), std::memory_order_relaxed);
+            row.allocated.fetch_add(allocations() - before, std::memory_order_relaxed);
+        };
+    }
+
+    template <typename E>
+    static auto tally(Row &row, function::Generator<E> generator) -> function::Generator<E>
+    {
+        return [&row, generator = std::move(generator)](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
+            generator(
+                [&row, &accept](E element, function::Timestamp index) -> void {
+                    row.elements.fetch_add(1, std::memory_order_relaxed);
+                    accept(element, index);
+                },
+                interrupt);
+        };
+    }
+
+    template <typename Body>
+    static auto measure(Row &row, Body &&body) -> decltype(body())
+    {
+        struct Stopwatch
+        {
+            Row &row;
+            std::uint64_t before = allocations();
+            pool::Clock::time_point start = pool::Clock::now();
+
+            ~Stopwatch()
+            {
+                row.elapsed.fetch_add(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(pool::Clock::now() - start).count()), std::memory_order_relaxed);
+                row.allocated.fetch_add(allocations() - before, std::memory_order_relaxed);
+            }
+        } stopwatch{row};
+        return body();
+    }
+
+    friend std::ostream &operator<<(std::ostream &stream, const Profile &profile)
+    {
+        std::lock_guard<std::mutex> lock(profile.mutex);
+        stream << std::left << std::setw(20) << "stage" << std::right << std::setw(14) << "in" << std::setw(14) << "out" << std::setw(12) << "self ms" << std::setw(12) << "total ms" << std::setw(12) << "allocs" << "\n";
+        for (const Row &row : profile.rows)
+        {
+            std::uint64_t out = row.elements.load(std::memory_order_relaxed);
+            stream << std::left << std::setw(20) << row.name << std::right << std::setw(14);
+            if (row.upstream != nullptr)
+            {
+                stream << row.upstream->elements.load(std::memory_order_relaxed);
+            }
+            else
+            {
+                stream << "-";
+            }
+            stream << std::setw(14) << out << std::fixed << std::setprecision(3) << std::setw(12) << static_cast<double>(row.exclusive()) / 1e6 << std::setw(12) << static_cast<double>(row.inclusive()) / 1e6 << std::setw(12) << row.allocations() << "\n";
+        }
+        return stream;
+    }
+};
+
+template <typename K, typename V>
+class Table
+{
+  private:
+    std::vector<std::pair<K, V>> entries;
+    std::vector<std::pair<std::size_t, std::size_t>> slots;
+    std::size_t mask = 0;
+
+    static auto mix(std::size_t hash) -> std::size_t
+    {
+        std::uint64_t value = static_cast<std::uint64_t>(hash);
+        value ^= value >> 33;
+        value *= 0xff51afd7ed558ccdULL;
+        value ^= value >> 33;
+        return static_cast<std::size_t>(value);
+    }
+
+    auto locate(const K &key, std::size_t hash) const -> std::size_t
+    {
+        std::size_t position = hash & mask;
+        while (slots[position].second != 0)
+        {
+            if (slots[position].first == hash && entries[slots[position].second - 1].first == key)
+            {
+                return position;
+            }
+            position = (position + 1) & mask;
+        }
+        return position;
+    }
+
+    auto rehash(std::size_t capacity) -> void
+    {
+        std::vector<std::pair<std::size_t, std::size_t>> previous(capacity, std::make_pair(0, 0));
+        previous.swap(slots);
+        mask = capacity - 1;
+        for (const auto &slot : previous)
+        {
+            if (slot.second != 0)
+            {
+                std::size_t position = slot.first & mask;
+                while (slots[position].second != 0)
                 {
-                    if (hasError.load())
-                    {
-                        break;
-                    }
-                    if ((*interrupt)(element, index, identityValue))
-                    {
-                        break;
-                    }
-                    if (index % concurrent == thread)
-                    {
-                        identityValue = (*accumulator)(identityValue, element, index);
-                    }
-                    ++index;
+                    position = (position + 1) & mask;
                 }
-                return identityValue;
-            }));
+                slots[position] = slot;
+            }
         }
+    }
 
-        return futures;
+    auto grow() -> void
+    {
+        if (slots.empty())
+        {
+            rehash(16);
+        }
+        else if ((entries.size() + 1) * 2 > slots.size())
+        {
+            rehash(slots.size() * 2);
+        }
     }
 
-    auto group(const function::Generator<E> &generator, const function::Module &concurrent) const -> std::vector<std::future<A>>
+  public:
+    using iterator = typename std::vector<std::pair<K, V>>::iterator;
+    using const_iterator = typename std::vector<std::pair<K, V>>::const_iterator;
+
+    Table() = default;
+
+    explicit Table(std::size_t capacity)
     {
-        std::atomic<bool> hasError{false};
-        std::vector<std::future<A>> futures;
-        futures.reserve(concurrent);
+        reserve(capacity);
+    }
 
-        for (function::Module thread = 0; thread < concurrent; ++thread)
+    auto reserve(std::size_t capacity) -> void
+    {
+        entries.reserve(capacity);
+        std::size_t required = 16;
+        while (required < capacity * 2)
         {
-            futures.emplace_back(globalPool().submit<A>([this, thread, &generator, concurrent, &hasError]() -> A {
-                A identityValue = (*identity)();
-                generator(
-                    [thread, &identityValue, concurrent, &hasError, this](E element, function::Timestamp index) -> void {
-                        if (!hasError.load() && index % concurrent == thread)
-                        {
-                            identityValue = (*accumulator)(identityValue, element, index);
-                        }
-                    },
-                    [&identityValue, &hasError, this](E element, function::Timestamp index) -> bool {
-                        return hasError.load() || (*interrupt)(element, index, identityValue);
-                    });
-                return identityValue;
-            }));
+            required <<= 1;
+        }
+        if (required > slots.size())
+        {
+            rehash(required);
+        }
+    }
+
+    template <typename... Args>
+    auto emplace(const K &key, Args &&...args) -> std::pair<V *, bool>
+    {
+        grow();
+        std::size_t hash = mix(std::hash<K>{}(key));
+        std::size_t position = locate(key, hash);
+        if (slots[position].second != 0)
+        {
+            return std::make_pair(&entries[slots[position].second - 1].second, false);
         }
+        entries.emplace_back(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+        slots[position] = std::make_pair(hash, entries.size());
+        return std::make_pair(&entries.back().second, true);
+    }
 
-        return futures;
+    auto operator[](const K &key) -> V &
+    {
+        return *emplace(key).first;
+    }
+
+    auto find(const K &key) -> V *
+    {
+        if (slots.empty())
+        {
+            return nullptr;
+        }
+        std::size_t position = locate(key, mix(std::hash<K>{}(key)));
+        return slots[position].second == 0 ? nullptr : &entries[slots[position].second - 1].second;
     }
 
-    auto concatenate(std::vector<std::future<A>> &futures) const -> A
+    auto find(const K &key) const -> const V *
     {
-        std::exception_ptr firstException;
-        std::mutex exceptionMutex;
-        std::atomic<bool> hasError{false};
+        if (slots.empty())
+        {
+            return nullptr;
+        }
+        std::size_t position = locate(key, mix(std::hash<K>{}(key)));
+        return slots[position].second == 0 ? nullptr : &entries[slots[position].second - 1].second;
+    }
 
-        A result = (*identity)();
-        for (auto &future : futures)
+    template <typename Merger>
+    auto merge(Table<K, V> &&other, Merger &&merger) -> void
+    {
+        reserve(entries.size() + other.entries.size());
+        for (auto &entry : other.entries)
         {
-            try
+            auto [value, inserted] = emplace(entry.first, std::move(entry.second));
+            if (!inserted)
             {
-                result = (*combiner)(std::move(result), future.get());
+                merger(*value, std::move(entry.second));
             }
-            catch (...)
+        }
+        other.clear();
+    }
+
+    auto clear() -> void
+    {
+        entries.clear();
+        slots.clear();
+        mask = 0;
+    }
+
+    auto size() const -> std::size_t
+    {
+        return entries.size();
+    }
+
+    auto empty() const -> bool
+    {
+        return entries.empty();
+    }
+
+    auto begin() -> iterator
+    {
+        return entries.begin();
+    }
+
+    auto end() -> iterator
+    {
+        return entries.end();
+    }
+
+    auto begin() const -> const_iterator
+    {
+        return entries.begin();
+    }
+
+    auto end() const -> const_iterator
+    {
+        return entries.end();
+    }
+};
+
+struct Tally
+{
+    function::Module count = 0;
+    double positionSum = 0.0;
+    function::Timestamp first = 0;
+    function::Timestamp last = 0;
+
+    auto add(const function::Timestamp &index) -> void
+    {
+        if (count == 0 || index < first)
+        {
+            first = index;
+        }
+        if (count == 0 || index > last)
+        {
+            last = index;
+        }
+        positionSum += static_cast<double>(index);
+        ++count;
+    }
+
+    auto merge(const Tally &other) -> void
+    {
+        if (other.count == 0)
+        {
+            return;
+        }
+        if (count == 0 || other.first < first)
+        {
+            first = other.first;
+        }
+        if (count == 0 || other.last > last)
+        {
+            last = other.last;
+        }
+        positionSum += other.positionSum;
+        count += other.count;
+    }
+};
+
+template <typename D>
+struct Moments
+{
+    using Value = std::conditional_t<std::is_same_v<D, long double>, long double, double>;
+
+    function::Module count = 0;
+    Value mean = Value{};
+    Value m2 = Value{};
+
+    auto add(const Value &value) -> void
+    {
+        ++count;
+        Value delta = value - mean;
+        mean += delta / static_cast<Value>(count);
+        m2 += delta * (value - mean);
+    }
+
+    template <typename E>
+    auto add(const E *data, const function::Module &size) -> void
+    {
+        for (function::Module index = 0; index < size; ++index)
+        {
+            add(static_cast<Value>(data[index]));
+        }
+    }
+
+    auto remove(const Value &value) -> void
+    {
+        if (count < 2)
+        {
+            *this = Moments<D>();
+            return;
+        }
+        Value delta = value - mean;
+        --count;
+        mean -= delta / static_cast<Value>(count);
+        m2 -= delta * (value - mean);
+        if (m2 < Value{})
+        {
+            m2 = Value{};
+        }
+    }
+
+    auto merge(const Moments<D> &other) -> void
+    {
+        if (other.count == 0)
+        {
+            return;
+        }
+        if (count == 0)
+        {
+            *this = other;
+            return;
+        }
+        function::Module total = count + other.count;
+        Value delta = other.mean - mean;
+        Value weight = static_cast<Value>(other.count) / static_cast<Value>(total);
+        mean += delta * weight;
+        m2 += other.m2 + delta * delta * static_cast<Value>(count) * weight;
+        count = total;
+    }
+
+    auto variance() const -> Value
+    {
+        return count == 0 ? Value{} : m2 / static_cast<Value>(count);
+    }
+};
+
+class Histogram
+{
+  private:
+    bool logarithmic = false;
+    double lower = 0.0;
+    double upper = 1.0;
+    double growth = 1.0;
+    std::int64_t offset = 0;
+    std::vector<function::Module> counts;
+    static constexpr double maximumBuckets = 4194304.0;
+    function::Module underflow = 0;
+    function::Module overflow = 0;
+    function::Module total = 0;
+    double minimum = 0.0;
+    double maximum = 0.0;
+
+    auto bound(std::size_t bucket) const -> double
+    {
+        if (logarithmic)
+        {
+            return std::pow(growth, static_cast<double>(offset + static_cast<std::int64_t>(bucket)));
+        }
+        return lower + (upper - lower) * static_cast<double>(bucket) / static_cast<double>(counts.size());
+    }
+
+    auto place(std::int64_t bucket) -> function::Module &
+    {
+        if (counts.empty())
+        {
+            offset = bucket;
+            counts.push_back(0);
+        }
+        else if (bucket < offset)
+        {
+            counts.insert(counts.begin(), static_cast<std::size_t>(offset - bucket), 0);
+            offset = bucket;
+        }
+        else if (bucket >= offset + static_cast<std::int64_t>(counts.size()))
+        {
+            counts.resize(static_cast<std::size_t>(bucket - offset + 1), 0);
+        }
+        return counts[static_cast<std::size_t>(bucket - offset)];
+    }
+
+    template <typename Visitor>
+    auto visit(Visitor &&visitor) const -> void
+    {
+        double underflowUpper = logarithmic ? std::min(maximum, 0.0) : std::min(maximum, lower);
+        if (underflow > 0 && !visitor(minimum, underflowUpper, underflow))
+        {
+            return;
+        }
+        for (std::size_t bucket = 0; bucket < counts.size(); ++bucket)
+        {
+            if (counts[bucket] > 0 && !visitor(std::max(bound(bucket), minimum), std::min(bound(bucket + 1), maximum), counts[bucket]))
             {
-                hasError.store(true);
-                std::lock_guard<std::mutex> lock(exceptionMutex);
-                if (!firstException)
-                {
-                    firstException = std::current_exception();
-                }
+                return;
             }
         }
+        if (overflow > 0)
+        {
+            double overflowLower = logarithmic ? (counts.empty() ? minimum : bound(counts.size())) : upper;
+            visitor(std::max(overflowLower, minimum), maximum, overflow);
+        }
+    }
+
+  public:
+    Histogram() = default;
+
+    Histogram(const std::size_t &bins, const double &lower, const double &upper)
+        : lower(lower), upper(upper), counts(bins, 0)
+    {
+        if (bins == 0)
+            throw std::invalid_argument("Histogram: bins must be positive");
+        if (!(lower < upper))
+            throw std::invalid_argument("Histogram: lower bound must be less than upper bound");
+    }
+
+    static auto useLogarithmic(const double &precision) -> Histogram
+    {
+        if (!(precision > 0.0))
+            throw std::invalid_argument("Histogram: precision must be positive");
+        double range = std::log(std::numeric_limits<double>::max()) - std::log(std::numeric_limits<double>::denorm_min());
+        if (!(range / std::log1p(precision) <= maximumBuckets))
+            throw std::invalid_argument("Histogram: precision is too small to bound the bucket span");
+        Histogram histogram;
+        histogram.logarithmic = true;
+        histogram.growth = 1.0 + precision;
+        return histogram;
+    }
+
+    auto add(const double &value, const function::Module &count = 1) -> void
+    {
+        if (count == 0 || std::isnan(value))
+        {
+            return;
+        }
+        if (total == 0)
+        {
+            minimum = value;
+            maximum = value;
+        }
+        else
+        {
+            minimum = std::min(minimum, value);
+            maximum = std::max(maximum, value);
+        }
+        total += count;
+        if (logarithmic)
+        {
+            if (value <= 0.0)
+                underflow += count;
+            else if (std::isinf(value))
+                overflow += count;
+            else
+                place(static_cast<std::int64_t>(std::floor(std::log(value) / std::log(growth)))) += count;
+            return;
+        }
+        if (value < lower)
+            underflow += count;
+        else if (value >= upper)
+            overflow += count;
+        else
+            counts[std::min(counts.size() - 1, static_cast<std::size_t>((value - lower) / (upper - lower) * static_cast<double>(counts.size())))] += count;
+    }
 
-        if (firstException)
+    auto merge(const Histogram &other) -> void
+    {
+        if (other.total == 0)
+        {
+            return;
+        }
+        if (logarithmic != other.logarithmic || (logarithmic ? growth != other.growth : (lower != other.lower || upper != other.upper || counts.size() != other.counts.size())))
+            throw std::invalid_argument("Histogram: cannot merge histograms with different layouts");
+        if (logarithmic)
+        {
+            for (std::size_t bucket = 0; bucket < other.counts.size(); ++bucket)
+            {
+                if (other.counts[bucket] > 0)
+                    place(other.offset + static_cast<std::int64_t>(bucket)) += other.counts[bucket];
+            }
+        }
+        else
         {
-            std::rethrow_exception(firstException);
+            for (std::size_t bucket = 0; bucket < counts.size(); ++bucket)
+                counts[bucket] += other.counts[bucket];
         }
+        minimum = total == 0 ? other.minimum : std::min(minimum, other.minimum);
+        maximum = total == 0 ? other.maximum : std::max(maximum, other.maximum);
+        underflow += other.underflow;
+        overflow += other.overflow;
+        total += other.total;
+    }
+
+    auto count() const -> function::Module
+    {
+        return total;
+    }
+
+    auto empty() const -> bool
+    {
+        return total == 0;
+    }
 
+    auto min() const -> std::optional<double>
+    {
+        return total == 0 ? std::nullopt : std::optional<double>(minimum);
+    }
+
+    auto max() const -> std::optional<double>
+    {
+        return total == 0 ? std::nullopt : std::optional<double>(maximum);
+    }
+
+    auto percentile(const double &p) const -> std::optional<double>
+    {
+        if (p < 0.0 || p > 100.0)
+            throw std::invalid_argument("Histogram: p must be in range [0.0, 100.0]");
+        if (total == 0)
+            return std::nullopt;
+        double target = p / 100.0 * static_cast<double>(total);
+        double cumulative = 0.0;
+        double result = maximum;
+        visit([&target, &cumulative, &result](double from, double to, function::Module count) -> bool {
+            if (cumulative + static_cast<double>(count) >= target)
+            {
+                double fraction = (target - cumulative) / static_cast<double>(count);
+                result = std::isinf(to - from) ? (fraction > 0.0 ? to : from) : from + fraction * (to - from);
+                return false;
+            }
+            cumulative += static_cast<double>(count);
+            return true;
+        });
+        return std::optional<double>(std::clamp(result, minimum, maximum));
+    }
+
+    auto cdf(const double &value) const -> double
+    {
+        if (total == 0 || value < minimum)
+            return 0.0;
+        if (value >= maximum)
+            return 1.0;
+        double cumulative = 0.0;
+        visit([&value, &cumulative](double from, double to, function::Module count) -> bool {
+            if (value >= to)
+            {
+                cumulative += static_cast<double>(count);
+                return true;
+            }
+            if (value > from && to > from)
+                cumulative += static_cast<double>(count) * (value - from) / (to - from);
+            return false;
+        });
+        return cumulative / static_cast<double>(total);
+    }
+
+    auto buckets() const -> std::vector<std::tuple<double, double, function::Module>>
+    {
+        std::vector<std::tuple<double, double, function::Module>> result;
+        visit([&result](double from, double to, function::Module count) -> bool {
+            result.emplace_back(from, to, count);
+            return true;
+        });
         return result;
     }
+};
+
+template <typename E, typename A, typename R>
+class Collector
+{
+  private:
+    std::unique_ptr<Identity<A>> identity;
+    std::unique_ptr<Interrupt<E, A>> interrupt;
+    std::unique_ptr<Accumulator<A, E>> accumulator;
+    std::unique_ptr<Combiner<A>> combiner;
+    std::unique_ptr<Finisher<A, R>> finisher;
+    std::unique_ptr<Block<A, E>> block;
+    std::unique_ptr<Reserve<A>> reserve;
+    std::unique_ptr<Gather<A>> gather;
+    bool decisive = false;
+
+    static auto cancelled(const pool::CancellationToken *token) -> bool
+    {
+        return token != nullptr && token->cancelled();
+    }
+
+    auto seed(const function::Module &expected) const -> A
+    {
+        A identityValue = (*identity)();
+        if (reserve && expected > 0)
+        {
+            (*reserve)(identityValue, expected);
+        }
+        return identityValue;
+    }
+
+    template <typename Lane>
+    auto reduce(const function::Module &concurrent, pool::Executor *executor, Lane &&lane) const -> A
+    {
+        pool::Executor &pool = currentExecutor(executor);
+        if (!gather)
+        {
+            return pool.parallelReduce<A>(0, concurrent, (*identity)(), std::forward<Lane>(lane), *combiner, 1);
+        }
+        std::vector<std::optional<A>> partials(concurrent);
+        pool.parallelFor(0, concurrent, [&partials, &lane](std::size_t from, std::size_t to) {
+            for (std::size_t thread = from; thread < to; ++thread)
+            {
+                partials[thread].emplace(lane(thread, thread + 1));
+            }
+        },
+                         1);
+        std::vector<A> lanes;
+        lanes.reserve(concurrent);
+        for (auto &partial : partials)
+        {
+            lanes.push_back(std::move(partial.value()));
+        }
+        return (*gather)(std::move(lanes), pool);
+    }
+
+    template <typename Container>
+    auto sequence(const Container &container, const pool::CancellationToken *token, const function::Module &expected = 0) const -> A
+    {
+        A identityValue = seed(expected);
+        function::Timestamp index = 0;
+        for (const auto &element : container)
+        {
+            if (cancelled(token) || (*interrupt)(element, index, identityValue))
+            {
+                break;
+            }
+            identityValue = (*accumulator)(std::move(identityValue), element, index);
+            ++index;
+        }
+        return identityValue;
+    }
+
+    auto finish(A result, const pool::CancellationToken *token) const -> R
+    {
+        if (token != nullptr)
+        {
+            token->check();
+        }
+        return (*finisher)(std::move(result));
+    }
+
+    template <typename Container>
+    auto group(const Container &container, const function::Module &concurrent, pool::Executor *executor, const pool::CancellationToken *token, const function::Module &expected = 0) const -> A
+    {
+        std::atomic<bool> stop{false};
+        return reduce(
+            concurrent, executor,
+            [this, &container, concurrent, &stop, token, expected](std::size_t thread, std::size_t) -> A {
+                A identityValue = seed((expected + concurrent - 1) / concurrent);
+                function::Module index = 0;
+                try
+                {
+                    for (const E &element : container)
+                    {
+                        if (stop.load(std::memory_order_relaxed) || cancelled(token))
+                        {
+                            break;
+                        }
+                        if ((*interrupt)(element, index, identityValue))
+                        {
+                            if (decisive)
+                            {
+                                stop.store(true, std::memory_order_relaxed);
+                            }
+                            break;
+                        }
+                        if (index % concurrent == thread)
+                        {
+                            identityValue = (*accumulator)(std::move(identityValue), element, index);
+                        }
+                        ++index;
+                    }
+                }
+                catch (...)
+                {
+                    stop.store(true);
+                    throw;
+                }
+                return identityValue;
+            });
+    }
+
+    auto group(const function::Generator<E> &generator, const function::Module &concurrent, pool::Executor *executor, const pool::CancellationToken *token, const function::Module &expected = 0) const -> A
+    {
+        std::atomic<bool> stop{false};
+        return reduce(
+            concurrent, executor,
+            [this, &generator, concurrent, &stop, token, expected](std::size_t thread, std::size_t) -> A {
+                A identityValue = seed((expected + concurrent - 1) / concurrent);
+                try
+                {
+                    generator(
+                        [thread, &identityValue, concurrent, &stop, this](E element, function::Timestamp index) -> void {
+                            if (!stop.load(std::memory_order_relaxed) && index % concurrent == thread)
+                            {
+                                identityValue = (*accumulator)(std::move(identityValue), element, index);
+                            }
+                        },
+                        [&identityValue, &stop, token, this](E element, function::Timestamp index) -> bool {
+                            if (stop.load(std::memory_order_relaxed) || cancelled(token))
+                            {
+                                return true;
+                            }
+                            if ((*interrupt)(element, index, identityValue))
+                            {
+                                if (decisive)
+                                {
+                                    stop.store(true, std::memory_order_relaxed);
+                                }
+                                return true;
+                            }
+                            return false;
+                        });
+                }
+                catch (...)
+                {
+                    stop.store(true);
+                    throw;
+                }
+                return identityValue;
+            });
+    }
+
+    auto partition(const E *data, const function::Module &size, const function::Module &concurrent, pool::Executor *executor) const -> A
+    {
+        return currentExecutor(executor).parallelReduce<A>(
+            0, size, (*identity)(),
+            [this, data](std::size_t from, std::size_t to) -> A { return (*block)(data + from, to - from); },
+            *combiner, (size + concurrent - 1) / concurrent);
+    }
 
   public:
     Collector(const Identity<A> &identity, const Interrupt<E, A> &interrupt, const Accumulator<A, E> &accumulator, const Combiner<A> &combiner, const Finisher<A, R> &finisher)
@@ -164,7 +956,7 @@ class Collector
     }
 
     Collector(Collector<E, A, R> &&other) noexcept
-        : identity(std::move(other.identity)), interrupt(std::move(other.interrupt)), accumulator(std::move(other.accumulator)), combiner(std::move(other.combiner)), finisher(std::move(other.finisher))
+        : identity(std::move(other.identity)), interrupt(std::move(other.interrupt)), accumulator(std::move(other.accumulator)), combiner(std::move(other.combiner)), finisher(std::move(other.finisher)), block(std::move(other.block)), reserve(std::move(other.reserve)), gather(std::move(other.gather)), decisive(other.decisive)
     {
     }
 
@@ -177,150 +969,146 @@ class Collector
             accumulator = std::move(other.accumulator);
             combiner = std::move(other.combiner);
             finisher = std::move(other.finisher);
+            block = std::move(other.block);
+            reserve = std::move(other.reserve);
+            gather = std::move(other.gather);
+            decisive = other.decisive;
         }
         return *this;
     }
 
     ~Collector() = default;
 
-    auto collect(const function::Generator<E> &generator, const function::Module &concurrent) const -> R
+    auto vectorize(const Block<A, E> &block) -> Collector<E, A, R> &
     {
+        this->block = std::make_unique<Block<A, E>>(block);
+        return *this;
+    }
+
+    auto vectorized() const -> bool
+    {
+        return static_cast<bool>(block);
+    }
+
+    auto shortCircuit() -> Collector<E, A, R> &
+    {
+        decisive = true;
+        return *this;
+    }
+
+    auto presize(const Reserve<A> &reserve) -> Collector<E, A, R> &
+    {
+        this->reserve = std::make_unique<Reserve<A>>(reserve);
+        return *this;
+    }
+
+    auto gathering(const Gather<A> &gather) -> Collector<E, A, R> &
+    {
+        this->gather = std::make_unique<Gather<A>>(gather);
+        return *this;
+    }
+
+    auto collect(const function::Generator<E> &generator, const function::Module &concurrent, pool::Executor *executor = nullptr, const function::Module &expected = 0) const -> R
+    {
+        const pool::CancellationToken *token = pool::CancellationToken::current();
         if (concurrent < 2)
         {
-            A identityValue = (*identity)();
+            A identityValue = seed(expected);
             generator(
                 [&identityValue, this](E element, function::Timestamp index) -> void {
-                    identityValue = (*accumulator)(identityValue, element, index);
+                    identityValue = (*accumulator)(std::move(identityValue), element, index);
                 },
-                [&identityValue, this](E element, function::Timestamp index) -> bool {
-                    return (*interrupt)(element, index, identityValue);
+                [&identityValue, token, this](E element, function::Timestamp index) -> bool {
+                    return cancelled(token) || (*interrupt)(element, index, identityValue);
                 });
-            return (*finisher)(identityValue);
+            return finish(std::move(identityValue), token);
         }
 
-        auto futures = group(generator, concurrent);
-        A result = concatenate(futures);
-        return (*finisher)(result);
+        return finish(group(generator, concurrent, executor, token, expected), token);
     }
 
     template <typename Container>
-    auto collect(const Container &container, const function::Module &concurrent) const -> R
+    auto collect(const Container &container, const function::Module &concurrent, pool::Executor *executor = nullptr) const -> R
     {
+        const pool::CancellationToken *token = pool::CancellationToken::current();
         if (concurrent < 2)
         {
-            A identityValue = (*identity)();
-            function::Timestamp index = 0;
-            for (const E &element : container)
+            return finish(sequence(container, token), token);
+        }
+
+        return finish(group(container, concurrent, executor, token), token);
+    }
+
+    auto collect(const std::vector<E> &container, const function::Module &concurrent, pool::Executor *executor = nullptr) const -> R
+    {
+        const pool::CancellationToken *token = pool::CancellationToken::current();
+        if constexpr (!std::is_same_v<E, bool>)
+        {
+            if (block && !container.empty())
             {
-                if ((*interrupt)(element, index, identityValue))
+                function::Module size = container.size();
+                if (concurrent < 2 || size < concurrent)
                 {
-                    break;
+                    return finish((*combiner)((*identity)(), (*block)(container.data(), size)), token);
                 }
-                identityValue = (*accumulator)(identityValue, element, index);
-                ++index;
+                return finish(partition(container.data(), size, concurrent, executor), token);
             }
-            return (*finisher)(identityValue);
         }
 
-        auto futures = group(container, concurrent);
-        A result = concatenate(futures);
-        return (*finisher)(result);
+        if (concurrent < 2)
+        {
+            return finish(sequence(container, token, container.size()), token);
+        }
+
+        return finish(group(container, concurrent, executor, token, container.size()), token);
     }
 
-    auto collect(const std::initializer_list<E> &container, const function::Module &concurrent) const -> R
+    auto collect(const std::initializer_list<E> &container, const function::Module &concurrent, pool::Executor *executor = nullptr) const -> R
     {
+        const pool::CancellationToken *token = pool::CancellationToken::current();
         if (concurrent < 2)
         {
-            A identityValue = (*identity)();
-            function::Timestamp index = 0;
-            for (const E &element : container)
-            {
-                if ((*interrupt)(element, index, identityValue))
-                {
-                    break;
-                }
-                identityValue = (*accumulator)(identityValue, element, index);
-                ++index;
-            }
-            return (*finisher)(identityValue);
+            return finish(sequence(container, token, container.size()), token);
         }
 
-        auto futures = group(container, concurrent);
-        A result = concatenate(futures);
-        return (*finisher)(result);
+        return finish(group(container, concurrent, executor, token, container.size()), token);
     }
 
     template <typename T, std::size_t N>
-    auto collect(const std::array<T, N> &container, const function::Module &concurrent) const -> R
+    auto collect(const std::array<T, N> &container, const function::Module &concurrent, pool::Executor *executor = nullptr) const -> R
     {
+        const pool::CancellationToken *token = pool::CancellationToken::current();
         if (concurrent < 2)
         {
-            A identityValue = (*identity)();
-            function::Timestamp index = 0;
-            for (const auto &element : container)
-            {
-                if ((*interrupt)(element, index, identityValue))
-                {
-                    break;
-                }
-                identityValue = (*accumulator)(identityValue, element, index);
-                ++index;
-            }
-            return (*finisher)(identityValue);
+            return finish(sequence(container, token, container.size()), token);
         }
 
-        auto futures = group(container, concurrent);
-        A result = concatenate(futures);
-        return (*finisher)(result);
+        return finish(group(container, concurrent, executor, token, container.size()), token);
     }
 
-    auto collect(const std::forward_list<E> &container, const function::Module &concurrent) const -> R
+    auto collect(const std::forward_list<E> &container, const function::Module &concurrent, pool::Executor *executor = nullptr) const -> R
     {
+        const pool::CancellationToken *token = pool::CancellationToken::current();
         if (concurrent < 2)
         {
-            A identityValue = (*identity)();
-            function::Timestamp index = 0;
-            for (const E &element : container)
-            {
-                if ((*interrupt)(element, index, identityValue))
-                {
-                    break;
-                }
-                identityValue = (*accumulator)(identityValue, element, index);
-                ++index;
-            }
-            return (*finisher)(identityValue);
+            return finish(sequence(container, token), token);
         }
 
-        auto futures = group(container, concurrent);
-        A result = concatenate(futures);
-        return (*finisher)(result);
+        return finish(group(container, concurrent, executor, token), token);
     }
 
-    auto collect(const std::deque<E> &container, const function::Module &concurrent) const -> R
+    auto collect(const std::deque<E> &container, const function::Module &concurrent, pool::Executor *executor = nullptr) const -> R
     {
+        const pool::CancellationToken *token = pool::CancellationToken::current();
         if (concurrent < 2)
         {
-            A identityValue = (*identity)();
-            function::Timestamp index = 0;
-            for (const E &element : container)
-            {
-                if ((*interrupt)(element, index, identityValue))
-                {
-                    break;
-                }
-                identityValue = (*accumulator)(identityValue, element, index);
-                ++index;
-            }
-            return (*finisher)(identityValue);
+            return finish(sequence(container, token, container.size()), token);
         }
 
-        auto futures = group(container, concurrent);
-        A result = concatenate(futures);
-        return (*finisher)(result);
+        return finish(group(container, concurrent, executor, token, container.size()), token);
     }
 
-    auto collect(std::stack<E> container, const function::Module &concurrent) const -> R
+    auto collect(std::stack<E> container, const function::Module &concurrent, pool::Executor *executor = nullptr) const -> R
     {
         std::vector<E> temp;
         while (!container.empty())
@@ -329,28 +1117,16 @@ class Collector
             container.pop();
         }
 
+        const pool::CancellationToken *token = pool::CancellationToken::current();
         if (concurrent < 2)
         {
-            A identityValue = (*identity)();
-            function::Timestamp index = 0;
-            for (const E &element : temp)
-            {
-                if ((*interrupt)(element, index, identityValue))
-                {
-                    break;
-                }
-                identityValue = (*accumulator)(identityValue, element, index);
-                ++index;
-            }
-            return (*finisher)(identityValue);
+            return finish(sequence(temp, token, temp.size()), token);
         }
 
-        auto futures = group(temp, concurrent);
-        A result = concatenate(futures);
-        return (*finisher)(result);
+        return finish(group(temp, concurrent, executor, token, temp.size()), token);
     }
 
-    auto collect(std::queue<E> container, const function::Module &concurrent) const -> R
+    auto collect(std::queue<E> container, const function::Module &concurrent, pool::Executor *executor = nullptr) const -> R
     {
         std::vector<E> temp;
         while (!container.empty())
@@ -359,25 +1135,13 @@ class Collector
             container.pop();
         }
 
+        const pool::CancellationToken *token = pool::CancellationToken::current();
         if (concurrent < 2)
         {
-            A identityValue = (*identity)();
-            function::Timestamp index = 0;
-            for (const E &element : temp)
-            {
-                if ((*interrupt)(element, index, identityValue))
-                {
-                    break;
-                }
-                identityValue = (*accumulator)(identityValue, element, index);
-                ++index;
-            }
-            return (*finisher)(identityValue);
+            return finish(sequence(temp, token, temp.size()), token);
         }
 
-        auto futures = group(temp, concurrent);
-        A result = concatenate(futures);
-        return (*finisher)(result);
+        return finish(group(temp, concurrent, executor, token, temp.size()), token);
     }
 };
 
@@ -387,19 +1151,65 @@ auto useFull(const Identity<A> &identity, const Accumulator<A, E> &accumulator,
     Interrupt<E, A> interrupt = [](const E element, const function::Timestamp &index, const A &accumulator) -> bool {
         return false;
     };
-    return Collector<E, A, R>(identity, std::move(interrupt), accumulator, combiner, finisher);
-}
-
-template <typename E, typename A, typename R>
-auto useShortable(const Identity<A> &identity, const Interrupt<E, A> &interrupt, const Accumulator<A, E> &accumulator, const Combiner<A> &combiner, const Finisher<A, R> &finisher) -> Collector<E, A, R>
-{
-    return Collector<E, A, R>(identity, interrupt, accumulator, combiner, finisher);
+    return Collector<E, A, R>(identity, std::move(interrupt), accumulator, combiner, finisher);
+}
+
+template <typename E, typename A, typename R>
+auto useShortable(const Identity<A> &identity, const Interrupt<E, A> &interrupt, const Accumulator<A, E> &accumulator, const Combiner<A> &combiner, const Finisher<A, R> &finisher) -> Collector<E, A, R>
+{
+    return Collector<E, A, R>(identity, interrupt, accumulator, combiner, finisher);
+}
+
+template <typename C>
+auto reserveSequence() -> Reserve<C>
+{
+    return [](C &accumulatorValue, function::Module expected) -> void {
+        accumulatorValue.reserve(expected);
+    };
+}
+
+template <typename C>
+auto gatherSequence() -> Gather<C>
+{
+    return [](std::vector<C> lanes, pool::Executor &executor) -> C {
+        using T = typename C::value_type;
+        std::vector<function::Module> offsets(lanes.size() + 1, 0);
+        for (std::size_t lane = 0; lane < lanes.size(); ++lane)
+        {
+            offsets[lane + 1] = offsets[lane] + lanes[lane].size();
+        }
+        if constexpr (std::is_default_constructible_v<T> && std::is_move_assignable_v<T> && !std::is_same_v<T, bool>)
+        {
+            C result(offsets.back());
+            executor.parallelFor(0, lanes.size(), [&lanes, &offsets, &result](std::size_t from, std::size_t to) {
+                for (std::size_t lane = from; lane < to; ++lane)
+                {
+                    std::move(lanes[lane].begin(), lanes[lane].end(), result.begin() + offsets[lane]);
+                }
+            },
+                                 1);
+            return result;
+        }
+        else
+        {
+            C result;
+            if constexpr (std::is_same_v<C, std::vector<T>>)
+            {
+                result.reserve(offsets.back());
+            }
+            for (auto &lane : lanes)
+            {
+                result.insert(result.end(), std::make_move_iterator(lane.begin()), std::make_move_iterator(lane.end()));
+            }
+            return result;
+        }
+    };
 }
 
 template <typename E, typename Predicate>
 auto useAllMatch(Predicate &&predicate) -> Collector<E, bool, bool>
 {
-    return useShortable<E, bool, bool>(
+    Collector<E, bool, bool> collectorValue = useShortable<E, bool, bool>(
         []() -> bool { return true; },
         [](E element, function::Timestamp index, bool accumulator) -> bool { return !accumulator; },
         [predicate](bool accumulator, E element, function::Timestamp index) -> bool {
@@ -411,12 +1221,14 @@ auto useAllMatch(Predicate &&predicate) -> Collector<E, bool, bool>
         },
         [](bool a, bool b) -> bool { return a && b; },
         [](bool accumulator) -> bool { return accumulator; });
+    collectorValue.shortCircuit();
+    return collectorValue;
 }
 
 template <typename E, typename Predicate>
 auto useAnyMatch(Predicate &&predicate) -> Collector<E, bool, bool>
 {
-    return useShortable<E, bool, bool>(
+    Collector<E, bool, bool> collectorValue = useShortable<E, bool, bool>(
         []() -> bool { return false; },
         [](E element, function::Timestamp index, bool accumulator) -> bool { return accumulator; },
         [predicate](bool accumulator, E element, function::Timestamp index) -> bool {
@@ -428,12 +1240,14 @@ auto useAnyMatch(Predicate &&predicate) -> Collector<E, bool, bool>
         },
         [](bool a, bool b) -> bool { return a || b; },
         [](bool accumulator) -> bool { return accumulator; });
+    collectorValue.shortCircuit();
+    return collectorValue;
 }
 
 template <typename E, typename Predicate>
 auto useNoneMatch(Predicate &&predicate) -> Collector<E, bool, bool>
 {
-    return useShortable<E, bool, bool>(
+    Collector<E, bool, bool> collectorValue = useShortable<E, bool, bool>(
         []() -> bool { return true; },
         [](E element, function::Timestamp index, bool accumulator) -> bool { return !accumulator; },
         [predicate](bool accumulator, E element, function::Timestamp index) -> bool {
@@ -445,6 +1259,8 @@ auto useNoneMatch(Predicate &&predicate) -> Collector<E, bool, bool>
         },
         [](bool a, bool b) -> bool { return a && b; },
         [](bool accumulator) -> bool { return accumulator; });
+    collectorValue.shortCircuit();
+    return collectorValue;
 }
 
 template <typename E, typename Consumer>
@@ -488,11 +1304,16 @@ Collector<E, A, R> useCollect(const Identity<R> &identity, const Interrupt<E, A>
 template <typename E, typename D>
 auto useSummate() -> Collector<E, D, D>
 {
-    return useFull<E, D, D>(
+    Collector<E, D, D> collectorValue = useFull<E, D, D>(
         []() -> D { return D{}; },
         [](D accumulatorValue, E element, function::Timestamp index) -> D { return accumulatorValue + static_cast<D>(element); },
         [](D a, D b) -> D { return a + b; },
         [](D accumulatorValue) -> D { return accumulatorValue; });
+    if constexpr (std::is_arithmetic_v<E> && std::is_arithmetic_v<D>)
+    {
+        collectorValue.vectorize([](const E *data, function::Module size) -> D { return kernel::summate<D>(data, size); });
+    }
+    return collectorValue;
 }
 
 template <typename E, typename D>
@@ -505,10 +1326,41 @@ auto useSummate(const function::Function<E, D> &mapper) -> Collector<E, D, D>
         [](D accumulatorValue) -> D { return accumulatorValue; });
 }
 
+template <typename E, typename D>
+auto useCompensatedSummate() -> Collector<E, std::pair<D, D>, D>
+{
+    Collector<E, std::pair<D, D>, D> collectorValue = useFull<E, std::pair<D, D>, D>(
+        []() -> std::pair<D, D> { return std::make_pair(D{}, D{}); },
+        [](std::pair<D, D> accumulatorValue, E element, function::Timestamp index) -> std::pair<D, D> {
+            D value = static_cast<D>(element);
+            D total = accumulatorValue.first + value;
+            if constexpr (std::is_integral_v<D>)
+                return std::make_pair(total, accumulatorValue.second);
+            else if (std::abs(accumulatorValue.first) >= std::abs(value))
+                return std::make_pair(total, accumulatorValue.second + ((accumulatorValue.first - total) + value));
+            return std::make_pair(total, accumulatorValue.second + ((value - total) + accumulatorValue.first));
+        },
+        [](std::pair<D, D> a, std::pair<D, D> b) -> std::pair<D, D> {
+            D total = a.first + b.first;
+            D compensation = a.second + b.second;
+            if constexpr (std::is_integral_v<D>)
+                return std::make_pair(total, compensation);
+            else if (std::abs(a.first) >= std::abs(b.first))
+                return std::make_pair(total, compensation + ((a.first - total) + b.first));
+            return std::make_pair(total, compensation + ((b.first - total) + a.first));
+        },
+        [](std::pair<D, D> accumulatorValue) -> D { return accumulatorValue.first + accumulatorValue.second; });
+    if constexpr (std::is_arithmetic_v<E> && std::is_arithmetic_v<D>)
+    {
+        collectorValue.vectorize([](const E *data, function::Module size) -> std::pair<D, D> { return kernel::compensatedSummate<D>(data, size); });
+    }
+    return collectorValue;
+}
+
 template <typename E, typename D>
 auto useAverage() -> Collector<E, std::pair<D, function::Module>, D>
 {
-    return useFull<E, std::pair<D, function::Module>, D>(
+    Collector<E, std::pair<D, function::Module>, D> collectorValue = useFull<E, std::pair<D, function::Module>, D>(
         []() -> std::pair<D, function::Module> { return std::make_pair(D{}, 0); },
         [](std::pair<D, function::Module> accumulatorValue, E element, function::Timestamp index) -> std::pair<D, function::Module> {
             D value = static_cast<D>(element);
@@ -522,6 +1374,11 @@ auto useAverage() -> Collector<E, std::pair<D, function::Module>, D>
                 return D{};
             return accumulatorValue.first / static_cast<D>(accumulatorValue.second);
         });
+    if constexpr (std::is_arithmetic_v<E> && std::is_arithmetic_v<D>)
+    {
+        collectorValue.vectorize([](const E *data, function::Module size) -> std::pair<D, function::Module> { return std::make_pair(kernel::summate<D>(data, size), size); });
+    }
+    return collectorValue;
 }
 
 template <typename E, typename D>
@@ -546,7 +1403,7 @@ auto useAverage(const function::Function<E, D> &mapper) -> Collector<E, std::pai
 template <typename E, typename D>
 auto useRange() -> Collector<E, std::pair<D, D>, D>
 {
-    return useFull<E, std::pair<D, D>, D>(
+    Collector<E, std::pair<D, D>, D> collectorValue = useFull<E, std::pair<D, D>, D>(
         []() -> std::pair<D, D> { return std::pair<D, D>(D{}, D{}); },
         [](std::pair<D, D> accumulatorValue, E element, function::Timestamp index) -> std::pair<D, D> {
             D mapped = static_cast<D>(element);
@@ -570,6 +1427,14 @@ auto useRange() -> Collector<E, std::pair<D, D>, D>
                 return D{};
             return accumulatorValue.second - accumulatorValue.first;
         });
+    if constexpr (std::is_arithmetic_v<E> && std::is_arithmetic_v<D> && kernel::preservesOrder<E, D>)
+    {
+        collectorValue.vectorize([](const E *data, function::Module size) -> std::pair<D, D> {
+            std::pair<E, E> extrema = kernel::extrema(data, size);
+            return std::pair<D, D>(static_cast<D>(extrema.first), static_cast<D>(extrema.second));
+        });
+    }
+    return collectorValue;
 }
 
 template <typename E, typename D>
@@ -604,7 +1469,7 @@ auto useRange(const function::Function<E, D> &mapper) -> Collector<E, std::pair<
 template <typename E, typename D>
 auto useMinimum() -> Collector<E, std::optional<D>, std::optional<D>>
 {
-    return useFull<E, std::optional<D>, std::optional<D>>(
+    Collector<E, std::optional<D>, std::optional<D>> collectorValue = useFull<E, std::optional<D>, std::optional<D>>(
         []() -> std::optional<D> { return std::nullopt; },
         [](std::optional<D> accumulatorValue, E element, function::Timestamp index) -> std::optional<D> {
             D value = static_cast<D>(element);
@@ -620,6 +1485,11 @@ auto useMinimum() -> Collector<E, std::optional<D>, std::optional<D>>
             return a.value() < b.value() ? a : b;
         },
         [](std::optional<D> accumulatorValue) -> std::optional<D> { return accumulatorValue; });
+    if constexpr (std::is_arithmetic_v<E> && std::is_arithmetic_v<D> && kernel::preservesOrder<E, D>)
+    {
+        collectorValue.vectorize([](const E *data, function::Module size) -> std::optional<D> { return std::optional<D>(static_cast<D>(kernel::minimum(data, size))); });
+    }
+    return collectorValue;
 }
 
 template <typename E, typename D>
@@ -646,7 +1516,7 @@ auto useMinimum(const function::Function<E, D> &mapper) -> Collector<E, std::opt
 template <typename E, typename D>
 auto useMaximum() -> Collector<E, std::optional<D>, std::optional<D>>
 {
-    return useFull<E, std::optional<D>, std::optional<D>>(
+    Collector<E, std::optional<D>, std::optional<D>> collectorValue = useFull<E, std::optional<D>, std::optional<D>>(
         []() -> std::optional<D> { return std::nullopt; },
         [](std::optional<D> accumulatorValue, E element, function::Timestamp index) -> std::optional<D> {
             D value = static_cast<D>(element);
@@ -662,6 +1532,11 @@ auto useMaximum() -> Collector<E, std::optional<D>, std::optional<D>>
             return a.value() > b.value() ? a : b;
         },
         [](std::optional<D> accumulatorValue) -> std::optional<D> { return accumulatorValue; });
+    if constexpr (std::is_arithmetic_v<E> && std::is_arithmetic_v<D> && kernel::preservesOrder<E, D>)
+    {
+        collectorValue.vectorize([](const E *data, function::Module size) -> std::optional<D> { return std::optional<D>(static_cast<D>(kernel::maximum(data, size))); });
+    }
+    return collectorValue;
 }
 
 template <typename E, typename D>
@@ -686,159 +1561,91 @@ auto useMaximum(const function::Function<E, D> &mapper) -> Collector<E, std::opt
 }
 
 template <typename E, typename D>
-auto useVariance() -> Collector<E, std::tuple<D, D, D, function::Module>, D>
+auto useVariance() -> Collector<E, Moments<D>, D>
 {
-    return useFull<E, std::tuple<D, D, D, function::Module>, D>(
-        []() -> std::tuple<D, D, D, function::Module> {
-            return std::make_tuple(D{}, D{}, D{}, function::Module{0});
+    Collector<E, Moments<D>, D> collectorValue = useFull<E, Moments<D>, D>(
+        []() -> Moments<D> { return Moments<D>(); },
+        [](Moments<D> accumulatorValue, E element, function::Timestamp index) -> Moments<D> {
+            accumulatorValue.add(static_cast<typename Moments<D>::Value>(element));
+            return accumulatorValue;
         },
-        [](std::tuple<D, D, D, function::Module> acc, E element, function::Timestamp index) -> std::tuple<D, D, D, function::Module> {
-            D value = static_cast<D>(element);
-            function::Module count = std::get<3>(acc) + 1;
-            D delta = value - std::get<0>(acc);
-            D newMean = std::get<0>(acc) + delta / static_cast<D>(count);
-            D delta2 = value - newMean;
-            D newM2 = std::get<1>(acc) + delta * delta2;
-            return std::make_tuple(newMean, newM2, std::get<2>(acc) + value, count);
-        },
-        [](std::tuple<D, D, D, function::Module> a, std::tuple<D, D, D, function::Module> b) -> std::tuple<D, D, D, function::Module> {
-            function::Module countA = std::get<3>(a);
-            function::Module countB = std::get<3>(b);
-            if (countA == 0)
-                return b;
-            if (countB == 0)
-                return a;
-            D delta = std::get<0>(b) - std::get<0>(a);
-            D totalCount = static_cast<D>(countA + countB);
-            D newMean = std::get<0>(a) + delta * static_cast<D>(countB) / totalCount;
-            D newM2 = std::get<1>(a) + std::get<1>(b) + delta * delta * static_cast<D>(countA) * static_cast<D>(countB) / totalCount;
-            return std::make_tuple(newMean, newM2, std::get<2>(a) + std::get<2>(b), countA + countB);
-        },
-        [](std::tuple<D, D, D, function::Module> acc) -> D {
-            function::Module count = std::get<3>(acc);
-            if (count == 0)
-                return D{};
-            return std::get<1>(acc) / static_cast<D>(count);
+        [](Moments<D> a, Moments<D> b) -> Moments<D> {
+            a.merge(b);
+            return a;
+        },
+        [](Moments<D> accumulatorValue) -> D { return static_cast<D>(accumulatorValue.variance()); });
+    if constexpr (std::is_arithmetic_v<E>)
+    {
+        collectorValue.vectorize([](const E *data, function::Module size) -> Moments<D> {
+            Moments<D> moments;
+            moments.add(data, size);
+            return moments;
         });
+    }
+    return collectorValue;
 }
 
 template <typename E, typename D>
-auto useVariance(const function::Function<E, D> &mapper) -> Collector<E, std::tuple<D, D, D, function::Module>, D>
+auto useVariance(const function::Function<E, D> &mapper) -> Collector<E, Moments<D>, D>
 {
-    return useFull<E, std::tuple<D, D, D, function::Module>, D>(
-        []() -> std::tuple<D, D, D, function::Module> {
-            return std::make_tuple(D{}, D{}, D{}, function::Module{0});
+    return useFull<E, Moments<D>, D>(
+        []() -> Moments<D> { return Moments<D>(); },
+        [mapper](Moments<D> accumulatorValue, E element, function::Timestamp index) -> Moments<D> {
+            accumulatorValue.add(static_cast<typename Moments<D>::Value>(mapper(element)));
+            return accumulatorValue;
         },
-        [mapper](std::tuple<D, D, D, function::Module> acc, E element, function::Timestamp index) -> std::tuple<D, D, D, function::Module> {
-            D value = mapper(element);
-            function::Module count = std::get<3>(acc) + 1;
-            D delta = value - std::get<0>(acc);
-            D newMean = std::get<0>(acc) + delta / static_cast<D>(count);
-            D delta2 = value - newMean;
-            D newM2 = std::get<1>(acc) + delta * delta2;
-            return std::make_tuple(newMean, newM2, std::get<2>(acc) + value, count);
-        },
-        [](std::tuple<D, D, D, function::Module> a, std::tuple<D, D, D, function::Module> b) -> std::tuple<D, D, D, function::Module> {
-            function::Module countA = std::get<3>(a);
-            function::Module countB = std::get<3>(b);
-            if (countA == 0)
-                return b;
-            if (countB == 0)
-                return a;
-            D delta = std::get<0>(b) - std::get<0>(a);
-            D totalCount = static_cast<D>(countA + countB);
-            D newMean = std::get<0>(a) + delta * static_cast<D>(countB) / totalCount;
-            D newM2 = std::get<1>(a) + std::get<1>(b) + delta * delta * static_cast<D>(countA) * static_cast<D>(countB) / totalCount;
-            return std::make_tuple(newMean, newM2, std::get<2>(a) + std::get<2>(b), countA + countB);
-        },
-        [](std::tuple<D, D, D, function::Module> acc) -> D {
-            function::Module count = std::get<3>(acc);
-            if (count == 0)
-                return D{};
-            return std::get<1>(acc) / static_cast<D>(count);
-        });
+        [](Moments<D> a, Moments<D> b) -> Moments<D> {
+            a.merge(b);
+            return a;
+        },
+        [](Moments<D> accumulatorValue) -> D { return static_cast<D>(accumulatorValue.variance()); });
 }
 
 template <typename E, typename D>
-auto useStandardDeviation() -> Collector<E, std::tuple<D, D, D, function::Module>, D>
+auto useStandardDeviation() -> Collector<E, Moments<D>, D>
 {
-    return useFull<E, std::tuple<D, D, D, function::Module>, D>(
-        []() -> std::tuple<D, D, D, function::Module> {
-            return std::make_tuple(D{}, D{}, D{}, function::Module{0});
+    Collector<E, Moments<D>, D> collectorValue = useFull<E, Moments<D>, D>(
+        []() -> Moments<D> { return Moments<D>(); },
+        [](Moments<D> accumulatorValue, E element, function::Timestamp index) -> Moments<D> {
+            accumulatorValue.add(static_cast<typename Moments<D>::Value>(element));
+            return accumulatorValue;
         },
-        [](std::tuple<D, D, D, function::Module> acc, E element, function::Timestamp index) -> std::tuple<D, D, D, function::Module> {
-            D value = static_cast<D>(element);
-            function::Module count = std::get<3>(acc) + 1;
-            D delta = value - std::get<0>(acc);
-            D newMean = std::get<0>(acc) + delta / static_cast<D>(count);
-            D delta2 = value - newMean;
-            D newM2 = std::get<1>(acc) + delta * delta2;
-            return std::make_tuple(newMean, newM2, std::get<2>(acc) + value, count);
-        },
-        [](std::tuple<D, D, D, function::Module> a, std::tuple<D, D, D, function::Module> b) -> std::tuple<D, D, D, function::Module> {
-            function::Module countA = std::get<3>(a);
-            function::Module countB = std::get<3>(b);
-            if (countA == 0)
-                return b;
-            if (countB == 0)
-                return a;
-            D delta = std::get<0>(b) - std::get<0>(a);
-            D totalCount = static_cast<D>(countA + countB);
-            D newMean = std::get<0>(a) + delta * static_cast<D>(countB) / totalCount;
-            D newM2 = std::get<1>(a) + std::get<1>(b) + delta * delta * static_cast<D>(countA) * static_cast<D>(countB) / totalCount;
-            return std::make_tuple(newMean, newM2, std::get<2>(a) + std::get<2>(b), countA + countB);
-        },
-        [](std::tuple<D, D, D, function::Module> acc) -> D {
-            function::Module count = std::get<3>(acc);
-            if (count == 0)
-                return D{};
-            D variance = std::get<1>(acc) / static_cast<D>(count);
-            return static_cast<D>(std::sqrt(static_cast<double>(variance)));
+        [](Moments<D> a, Moments<D> b) -> Moments<D> {
+            a.merge(b);
+            return a;
+        },
+        [](Moments<D> accumulatorValue) -> D { return static_cast<D>(std::sqrt(accumulatorValue.variance())); });
+    if constexpr (std::is_arithmetic_v<E>)
+    {
+        collectorValue.vectorize([](const E *data, function::Module size) -> Moments<D> {
+            Moments<D> moments;
+            moments.add(data, size);
+            return moments;
         });
+    }
+    return collectorValue;
 }
 
 template <typename E, typename D>
-auto useStandardDeviation(const function::Function<E, D> &mapper) -> Collector<E, std::tuple<D, D, D, function::Module>, D>
+auto useStandardDeviation(const function::Function<E, D> &mapper) -> Collector<E, Moments<D>, D>
 {
-    return useFull<E, std::tuple<D, D, D, function::Module>, D>(
-        []() -> std::tuple<D, D, D, function::Module> {
-            return std::make_tuple(D{}, D{}, D{}, function::Module{0});
+    return useFull<E, Moments<D>, D>(
+        []() -> Moments<D> { return Moments<D>(); },
+        [mapper](Moments<D> accumulatorValue, E element, function::Timestamp index) -> Moments<D> {
+            accumulatorValue.add(static_cast<typename Moments<D>::Value>(mapper(element)));
+            return accumulatorValue;
         },
-        [mapper](std::tuple<D, D, D, function::Module> acc, E element, function::Timestamp index) -> std::tuple<D, D, D, function::Module> {
-            D value = mapper(element);
-            function::Module count = std::get<3>(acc) + 1;
-            D delta = value - std::get<0>(acc);
-            D newMean = std::get<0>(acc) + delta / static_cast<D>(count);
-            D delta2 = value - newMean;
-            D newM2 = std::get<1>(acc) + delta * delta2;
-            return std::make_tuple(newMean, newM2, std::get<2>(acc) + value, count);
-        },
-        [](std::tuple<D, D, D, function::Module> a, std::tuple<D, D, D, function::Module> b) -> std::tuple<D, D, D, function::Module> {
-            function::Module countA = std::get<3>(a);
-            function::Module countB = std::get<3>(b);
-            if (countA == 0)
-                return b;
-            if (countB == 0)
-                return a;
-            D delta = std::get<0>(b) - std::get<0>(a);
-            D totalCount = static_cast<D>(countA + countB);
-            D newMean = std::get<0>(a) + delta * static_cast<D>(countB) / totalCount;
-            D newM2 = std::get<1>(a) + std::get<1>(b) + delta * delta * static_cast<D>(countA) * static_cast<D>(countB) / totalCount;
-            return std::make_tuple(newMean, newM2, std::get<2>(a) + std::get<2>(b), countA + countB);
-        },
-        [](std::tuple<D, D, D, function::Module> acc) -> D {
-            function::Module count = std::get<3>(acc);
-            if (count == 0)
-                return D{};
-            D variance = std::get<1>(acc) / static_cast<D>(count);
-            return static_cast<D>(std::sqrt(static_cast<double>(variance)));
-        });
+        [](Moments<D> a, Moments<D> b) -> Moments<D> {
+            a.merge(b);
+            return a;
+        },
+        [](Moments<D> accumulatorValue) -> D { return static_cast<D>(std::sqrt(accumulatorValue.variance())); });
 }
 
 template <typename E>
 auto useFindAny() -> Collector<E, std::optional<E>, std::optional<E>>
 {
-    return useShortable<E, std::optional<E>, std::optional<E>>(
+    Collector<E, std::optional<E>, std::optional<E>> collectorValue = useShortable<E, std::optional<E>, std::optional<E>>(
         []() -> std::optional<E> { return std::nullopt; },
         [](E element, function::Timestamp index, std::optional<E> accumulatorValue) -> bool { return accumulatorValue.has_value(); },
         [](std::optional<E> accumulatorValue, E element, function::Timestamp index) -> std::optional<E> {
@@ -854,6 +1661,8 @@ auto useFindAny() -> Collector<E, std::optional<E>, std::optional<E>>
             return std::nullopt;
         },
         [](std::optional<E> accumulatorValue) -> std::optional<E> { return accumulatorValue; });
+    collectorValue.shortCircuit();
+    return collectorValue;
 }
 
 template <typename E>
@@ -2095,10 +2904,187 @@ auto useDistribution(const function::Function<E, D> &mapper) -> Collector<E, std
         });
 }
 
+template <typename K>
+auto finishDistribution(Table<K, Tally> &table) -> std::map<K, std::complex<double>>
+{
+    std::map<K, std::complex<double>> result;
+    if (table.empty())
+        return result;
+    double modePositionSum = 0.0;
+    double modeCount = 0.0;
+    {
+        std::map<double, std::size_t> positionFreq;
+        std::map<double, std::size_t> countFreq;
+        for (const auto &entry : table)
+        {
+            positionFreq[entry.second.positionSum]++;
+            countFreq[static_cast<double>(entry.second.count)]++;
+        }
+        std::size_t maxFreq = 0;
+        for (const auto &p : positionFreq)
+        {
+            if (p.second > maxFreq)
+            {
+                maxFreq = p.second;
+                modePositionSum = p.first;
+            }
+        }
+        maxFreq = 0;
+        for (const auto &p : countFreq)
+        {
+            if (p.second > maxFreq)
+            {
+                maxFreq = p.second;
+                modeCount = p.first;
+            }
+        }
+    }
+    double positionStddev = 0.0;
+    double countStddev = 0.0;
+    for (const auto &entry : table)
+    {
+        double posDiff = entry.second.positionSum - modePositionSum;
+        double cntDiff = static_cast<double>(entry.second.count) - modeCount;
+        positionStddev += posDiff * posDiff;
+        countStddev += cntDiff * cntDiff;
+    }
+    positionStddev = std::sqrt(positionStddev / static_cast<double>(table.size()));
+    countStddev = std::sqrt(countStddev / static_cast<double>(table.size()));
+    if (positionStddev < 0.001)
+        positionStddev = 1.0;
+    if (countStddev < 0.001)
+        countStddev = 1.0;
+    for (const auto &entry : table)
+    {
+        double posScore = (entry.second.positionSum - modePositionSum) / positionStddev;
+        double cntScore = (static_cast<double>(entry.second.count) - modeCount) / countStddev;
+        result[entry.first] = std::complex<double>(posScore, cntScore);
+    }
+    return result;
+}
+
+template <typename K>
+auto finishFrequency(std::pair<Table<K, std::vector<function::Timestamp>>, function::Timestamp> &accumulatorValue) -> std::map<K, std::pair<std::vector<std::complex<double>>, std::vector<std::complex<double>>>>
+{
+    std::map<K, std::pair<std::vector<std::complex<double>>, std::vector<std::complex<double>>>> result;
+    double totalLength = static_cast<double>(accumulatorValue.second + 1);
+    for (auto &entry : accumulatorValue.first)
+    {
+        std::pair<std::vector<std::complex<double>>, std::vector<std::complex<double>>> &target = result[entry.first];
+        target.first.reserve(entry.second.size());
+        target.second.reserve(entry.second.size());
+        for (function::Timestamp position : entry.second)
+        {
+            target.first.emplace_back(static_cast<double>(position), 1.0);
+            target.second.emplace_back(static_cast<double>(position), totalLength);
+        }
+        std::vector<function::Timestamp>().swap(entry.second);
+    }
+    return result;
+}
+
+template <typename E>
+auto useCompactFrequency() -> Collector<E, std::pair<Table<E, std::vector<function::Timestamp>>, function::Timestamp>, std::map<E, std::pair<std::vector<std::complex<double>>, std::vector<std::complex<double>>>>>
+{
+    using AccumulatorType = std::pair<Table<E, std::vector<function::Timestamp>>, function::Timestamp>;
+    using ResultMap = std::map<E, std::pair<std::vector<std::complex<double>>, std::vector<std::complex<double>>>>;
+    return useFull<E, AccumulatorType, ResultMap>(
+        []() -> AccumulatorType {
+            return AccumulatorType(Table<E, std::vector<function::Timestamp>>(), 0LL);
+        },
+        [](AccumulatorType accumulatorValue, E element, function::Timestamp index) -> AccumulatorType {
+            accumulatorValue.first[element].push_back(index);
+            accumulatorValue.second = index;
+            return accumulatorValue;
+        },
+        [](AccumulatorType a, AccumulatorType b) -> AccumulatorType {
+            a.first.merge(std::move(b.first), [](std::vector<function::Timestamp> &target, std::vector<function::Timestamp> &&source) -> void {
+                target.insert(target.end(), source.begin(), source.end());
+            });
+            if (b.second > a.second)
+            {
+                a.second = b.second;
+            }
+            return a;
+        },
+        [](AccumulatorType accumulatorValue) -> ResultMap {
+            return finishFrequency<E>(accumulatorValue);
+        });
+}
+
+template <typename E, typename D>
+auto useCompactFrequency(const function::Function<E, D> &mapper) -> Collector<E, std::pair<Table<D, std::vector<function::Timestamp>>, function::Timestamp>, std::map<D, std::pair<std::vector<std::complex<double>>, std::vector<std::complex<double>>>>>
+{
+    using AccumulatorType = std::pair<Table<D, std::vector<function::Timestamp>>, function::Timestamp>;
+    using ResultMap = std::map<D, std::pair<std::vector<std::complex<double>>, std::vector<std::complex<double>>>>;
+    return useFull<E, AccumulatorType, ResultMap>(
+        []() -> AccumulatorType {
+            return AccumulatorType(Table<D, std::vector<function::Timestamp>>(), 0LL);
+        },
+        [mapper](AccumulatorType accumulatorValue, E element, function::Timestamp index) -> AccumulatorType {
+            accumulatorValue.first[mapper(element)].push_back(index);
+            accumulatorValue.second = index;
+            return accumulatorValue;
+        },
+        [](AccumulatorType a, AccumulatorType b) -> AccumulatorType {
+            a.first.merge(std::move(b.first), [](std::vector<function::Timestamp> &target, std::vector<function::Timestamp> &&source) -> void {
+                target.insert(target.end(), source.begin(), source.end());
+            });
+            if (b.second > a.second)
+            {
+                a.second = b.second;
+            }
+            return a;
+        },
+        [](AccumulatorType accumulatorValue) -> ResultMap {
+            return finishFrequency<D>(accumulatorValue);
+        });
+}
+
+template <typename E>
+auto useCompactDistribution() -> Collector<E, Table<E, Tally>, std::map<E, std::complex<double>>>
+{
+    return useFull<E, Table<E, Tally>, std::map<E, std::complex<double>>>(
+        []() -> Table<E, Tally> {
+            return Table<E, Tally>();
+        },
+        [](Table<E, Tally> accumulatorValue, E element, function::Timestamp index) -> Table<E, Tally> {
+            accumulatorValue[element].add(index);
+            return accumulatorValue;
+        },
+        [](Table<E, Tally> a, Table<E, Tally> b) -> Table<E, Tally> {
+            a.merge(std::move(b), [](Tally &target, Tally &&source) -> void { target.merge(source); });
+            return a;
+        },
+        [](Table<E, Tally> accumulatorValue) -> std::map<E, std::complex<double>> {
+            return finishDistribution<E>(accumulatorValue);
+        });
+}
+
+template <typename E, typename D>
+auto useCompactDistribution(const function::Function<E, D> &mapper) -> Collector<E, Table<D, Tally>, std::map<D, std::complex<double>>>
+{
+    return useFull<E, Table<D, Tally>, std::map<D, std::complex<double>>>(
+        []() -> Table<D, Tally> {
+            return Table<D, Tally>();
+        },
+        [mapper](Table<D, Tally> accumulatorValue, E element, function::Timestamp index) -> Table<D, Tally> {
+            accumulatorValue[mapper(element)].add(index);
+            return accumulatorValue;
+        },
+        [](Table<D, Tally> a, Table<D, Tally> b) -> Table<D, Tally> {
+            a.merge(std::move(b), [](Tally &target, Tally &&source) -> void { target.merge(source); });
+            return a;
+        },
+        [](Table<D, Tally> accumulatorValue) -> std::map<D, std::complex<double>> {
+            return finishDistribution<D>(accumulatorValue);
+        });
+}
+
 template <typename E>
 auto usePartition(const function::Module &size) -> Collector<E, std::vector<std::vector<E>>, std::vector<std::vector<E>>>
 {
-    return useFull<E, std::vector<std::vector<E>>, std::vector<std::vector<E>>>(
+    Collector<E, std::vector<std::vector<E>>, std::vector<std::vector<E>>> collectorValue = useFull<E, std::vector<std::vector<E>>, std::vector<std::vector<E>>>(
         []() -> std::vector<std::vector<E>> { return std::vector<std::vector<E>>(); },
         [size](std::vector<std::vector<E>> accumulatorValue, E element, function::Timestamp index) -> std::vector<std::vector<E>> {
             if (size <= 1)
@@ -2133,6 +3119,42 @@ auto usePartition(const function::Module &size) -> Collector<E, std::vector<std:
             return a;
         },
         [](std::vector<std::vector<E>> accumulatorValue) -> std::vector<std::vector<E>> { return accumulatorValue; });
+    collectorValue.presize([size](std::vector<std::vector<E>> &accumulatorValue, function::Module expected) -> void {
+        function::Module width = std::max<function::Module>(size, 1);
+        accumulatorValue.reserve((expected + width - 1) / width);
+    });
+    collectorValue.gathering([size](std::vector<std::vector<std::vector<E>>> lanes, pool::Executor &) -> std::vector<std::vector<E>> {
+        function::Module width = std::max<function::Module>(size, 1);
+        function::Module total = 0;
+        for (const auto &lane : lanes)
+        {
+            for (const auto &chunk : lane)
+            {
+                total += chunk.size();
+            }
+        }
+        std::vector<std::vector<E>> result;
+        result.reserve((total + width - 1) / width);
+        function::Module remaining = total;
+        for (auto &lane : lanes)
+        {
+            for (auto &chunk : lane)
+            {
+                for (auto &element : chunk)
+                {
+                    if (result.empty() || result.back().size() >= width)
+                    {
+                        result.emplace_back();
+                        result.back().reserve(std::min(width, remaining));
+                    }
+                    result.back().push_back(std::move(element));
+                    --remaining;
+                }
+            }
+        }
+        return result;
+    });
+    return collectorValue;
 }
 
 template <typename E, typename KeyExtractor>
@@ -2205,7 +3227,7 @@ auto usePartitionBy(KeyExtractor &&keyExtractor, ValueExtractor &&valueExtractor
 template <typename E, typename D>
 auto useMedian() -> Collector<E, std::vector<D>, std::optional<D>>
 {
-    return useFull<E, std::vector<D>, std::optional<D>>(
+    Collector<E, std::vector<D>, std::optional<D>> collectorValue = useFull<E, std::vector<D>, std::optional<D>>(
         []() -> std::vector<D> { return std::vector<D>(); },
         [](std::vector<D> accumulatorValue, E element, function::Timestamp index) -> std::vector<D> {
             accumulatorValue.push_back(static_cast<D>(element));
@@ -2223,12 +3245,15 @@ auto useMedian() -> Collector<E, std::vector<D>, std::optional<D>>
                 return std::optional<D>(accumulatorValue[accumulatorValue.size() / 2]);
             return std::optional<D>((accumulatorValue[accumulatorValue.size() / 2 - 1] + accumulatorValue[accumulatorValue.size() / 2]) / static_cast<D>(2));
         });
+    collectorValue.presize(reserveSequence<std::vector<D>>());
+    collectorValue.gathering(gatherSequence<std::vector<D>>());
+    return collectorValue;
 }
 
 template <typename E, typename D>
 auto useMedian(const function::Function<E, D> &mapper) -> Collector<E, std::vector<D>, std::optional<D>>
 {
-    return useFull<E, std::vector<D>, std::optional<D>>(
+    Collector<E, std::vector<D>, std::optional<D>> collectorValue = useFull<E, std::vector<D>, std::optional<D>>(
         []() -> std::vector<D> { return std::vector<D>(); },
         [mapper](std::vector<D> accumulatorValue, E element, function::Timestamp index) -> std::vector<D> {
             accumulatorValue.push_back(mapper(element));
@@ -2246,6 +3271,9 @@ auto useMedian(const function::Function<E, D> &mapper) -> Collector<E, std::vect
                 return std::optional<D>(accumulatorValue[accumulatorValue.size() / 2]);
             return std::optional<D>((accumulatorValue[accumulatorValue.size() / 2 - 1] + accumulatorValue[accumulatorValue.size() / 2]) / static_cast<D>(2));
         });
+    collectorValue.presize(reserveSequence<std::vector<D>>());
+    collectorValue.gathering(gatherSequence<std::vector<D>>());
+    return collectorValue;
 }
 
 template <typename E>
@@ -2276,6 +3304,32 @@ auto useMode() -> Collector<E, std::unordered_map<E, std::complex<double>>, std:
         });
 }
 
+template <typename E>
+auto useCompactMode() -> Collector<E, Table<E, Tally>, std::optional<E>>
+{
+    return useFull<E, Table<E, Tally>, std::optional<E>>(
+        []() -> Table<E, Tally> { return Table<E, Tally>(); },
+        [](Table<E, Tally> accumulatorValue, E element, function::Timestamp index) -> Table<E, Tally> {
+            accumulatorValue[element].add(index);
+            return accumulatorValue;
+        },
+        [](Table<E, Tally> a, Table<E, Tally> b) -> Table<E, Tally> {
+            a.merge(std::move(b), [](Tally &target, Tally &&source) -> void { target.merge(source); });
+            return a;
+        },
+        [](Table<E, Tally> accumulatorValue) -> std::optional<E> {
+            if (accumulatorValue.empty())
+                return std::nullopt;
+            auto modeIter = std::max_element(accumulatorValue.begin(), accumulatorValue.end(),
+                                             [](const auto &a, const auto &b) {
+                                                 if (a.second.count != b.second.count)
+                                                     return a.second.count < b.second.count;
+                                                 return a.second.first > b.second.first;
+                                             });
+            return std::optional<E>(modeIter->first);
+        });
+}
+
 template <typename E, typename D>
 auto usePercentile(double p) -> Collector<E, std::vector<D>, std::optional<D>>
 {
@@ -2334,6 +3388,74 @@ auto usePercentile(double p, const function::Function<E, D> &mapper) -> Collecto
         });
 }
 
+template <typename E>
+auto useHistogram(const std::size_t &bins, const double &lower, const double &upper) -> Collector<E, Histogram, Histogram>
+{
+    Histogram layout(bins, lower, upper);
+    return useFull<E, Histogram, Histogram>(
+        [layout]() -> Histogram { return layout; },
+        [](Histogram accumulatorValue, E element, function::Timestamp index) -> Histogram {
+            accumulatorValue.add(static_cast<double>(element));
+            return accumulatorValue;
+        },
+        [](Histogram a, Histogram b) -> Histogram {
+            a.merge(b);
+            return a;
+        },
+        [](Histogram accumulatorValue) -> Histogram { return accumulatorValue; });
+}
+
+template <typename E, typename D>
+auto useHistogram(const std::size_t &bins, const double &lower, const double &upper, const function::Function<E, D> &mapper) -> Collector<E, Histogram, Histogram>
+{
+    Histogram layout(bins, lower, upper);
+    return useFull<E, Histogram, Histogram>(
+        [layout]() -> Histogram { return layout; },
+        [mapper](Histogram accumulatorValue, E element, function::Timestamp index) -> Histogram {
+            accumulatorValue.add(static_cast<double>(mapper(element)));
+            return accumulatorValue;
+        },
+        [](Histogram a, Histogram b) -> Histogram {
+            a.merge(b);
+            return a;
+        },
+        [](Histogram accumulatorValue) -> Histogram { return accumulatorValue; });
+}
+
+template <typename E>
+auto useLogHistogram(const double &precision) -> Collector<E, Histogram, Histogram>
+{
+    Histogram layout = Histogram::useLogarithmic(precision);
+    return useFull<E, Histogram, Histogram>(
+        [layout]() -> Histogram { return layout; },
+        [](Histogram accumulatorValue, E element, function::Timestamp index) -> Histogram {
+            accumulatorValue.add(static_cast<double>(element));
+            return accumulatorValue;
+        },
+        [](Histogram a, Histogram b) -> Histogram {
+            a.merge(b);
+            return a;
+        },
+        [](Histogram accumulatorValue) -> Histogram { return accumulatorValue; });
+}
+
+template <typename E, typename D>
+auto useLogHistogram(const double &precision, const function::Function<E, D> &mapper) -> Collector<E, Histogram, Histogram>
+{
+    Histogram layout = Histogram::useLogarithmic(precision);
+    return useFull<E, Histogram, Histogram>(
+        [layout]() -> Histogram { return layout; },
+        [mapper](Histogram accumulatorValue, E element, function::Timestamp index) -> Histogram {
+            accumulatorValue.add(static_cast<double>(mapper(element)));
+            return accumulatorValue;
+        },
+        [](Histogram a, Histogram b) -> Histogram {
+            a.merge(b);
+            return a;
+        },
+        [](Histogram accumulatorValue) -> Histogram { return accumulatorValue; });
+}
+
 template <typename E>
 auto useReduce(const function::BiFunction<E, E, E> &reducer) -> Collector<E, std::optional<E>, std::optional<E>>
 {
@@ -2434,7 +3556,7 @@ auto useToUnorderedMap(const function::BiFunction<E, function::Timestamp, K> &ke
 template <typename E>
 auto useToVector() -> Collector<E, std::vector<E>, std::vector<E>>
 {
-    return useFull<E, std::vector<E>, std::vector<E>>(
+    Collector<E, std::vector<E>, std::vector<E>> collectorValue = useFull<E, std::vector<E>, std::vector<E>>(
         []() -> std::vector<E> { return std::vector<E>(); },
         [](std::vector<E> accumulatorValue, E element, function::Timestamp index) -> std::vector<E> {
             accumulatorValue.push_back(element);
@@ -2445,6 +3567,32 @@ auto useToVector() -> Collector<E, std::vector<E>, std::vector<E>>
             return a;
         },
         [](std::vector<E> accumulatorValue) -> std::vector<E> { return accumulatorValue; });
+    collectorValue.presize(reserveSequence<std::vector<E>>());
+    collectorValue.gathering(gatherSequence<std::vector<E>>());
+    return collectorValue;
+}
+
+template <typename E>
+auto useToVector(const function::Module &expected) -> Collector<E, std::vector<E>, std::vector<E>>
+{
+    Collector<E, std::vector<E>, std::vector<E>> collectorValue = useFull<E, std::vector<E>, std::vector<E>>(
+        [expected]() -> std::vector<E> {
+            std::vector<E> values;
+            values.reserve(expected);
+            return values;
+        },
+        [](std::vector<E> accumulatorValue, E element, function::Timestamp index) -> std::vector<E> {
+            accumulatorValue.push_back(element);
+            return accumulatorValue;
+        },
+        [](std::vector<E> a, std::vector<E> b) -> std::vector<E> {
+            a.insert(a.end(), b.begin(), b.end());
+            return a;
+        },
+        [](std::vector<E> accumulatorValue) -> std::vector<E> { return accumulatorValue; });
+    collectorValue.presize(reserveSequence<std::vector<E>>());
+    collectorValue.gathering(gatherSequence<std::vector<E>>());
+    return collectorValue;
 }
 
 template <typename E>
@@ -2489,7 +3637,7 @@ auto useToUnorderedSet() -> Collector<E, std::unordered_set<E>, std::unordered_s
 template <typename E>
 auto useToDeque() -> Collector<E, std::deque<E>, std::deque<E>>
 {
-    return useFull<E, std::deque<E>, std::deque<E>>(
+    Collector<E, std::deque<E>, std::deque<E>> collectorValue = useFull<E, std::deque<E>, std::deque<E>>(
         []() -> std::deque<E> { return std::deque<E>(); },
         [](std::deque<E> accumulatorValue, E element, function::Timestamp index) -> std::deque<E> {
             accumulatorValue.push_back(element);
@@ -2500,6 +3648,8 @@ auto useToDeque() -> Collector<E, std::deque<E>, std::deque<E>>
             return a;
         },
         [](std::deque<E> accumulatorValue) -> std::deque<E> { return accumulatorValue; });
+    collectorValue.gathering(gatherSequence<std::deque<E>>());
+    return collectorValue;
 }
 
 template <typename E>
@@ -2744,7 +3894,7 @@ auto useToPriorityQueue() -> Collector<E, std::priority_queue<E>, std::priority_
 template <typename E>
 auto useDFT() -> Collector<E, std::vector<std::complex<double>>, std::vector<std::complex<double>>>
 {
-    return useFull<E, std::vector<std::complex<double>>, std::vector<std::complex<double>>>(
+    Collector<E, std::vector<std::complex<double>>, std::vector<std::complex<double>>> collectorValue = useFull<E, std::vector<std::complex<double>>, std::vector<std::complex<double>>>(
         []() -> std::vector<std::complex<double>> { return std::vector<std::complex<double>>(); },
         [](std::vector<std::complex<double>> accumulatorValue, E element, function::Timestamp index) -> std::vector<std::complex<double>> {
             if constexpr (std::is_arithmetic_v<E>)
@@ -2776,6 +3926,9 @@ auto useDFT() -> Collector<E, std::vector<std::complex<double>>, std::vector<std
             }
             return result;
         });
+    collectorValue.presize(reserveSequence<std::vector<std::complex<double>>>());
+    collectorValue.gathering(gatherSequence<std::vector<std::complex<double>>>());
+    return collectorValue;
 }
 
 template <typename E>
@@ -3237,4 +4390,47 @@ auto useKurtosis(const function::Function<E, D> &mapper) -> Collector<E, std::ve
             return kurt - adjustment;
         });
 }
-} // namespace collector
\ No newline at end of file
+} // namespace collector
+#if defined(SEMANTIC_PROFILE_ALLOCATIONS)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void *operator new(std::size_t size)
+{
+    ++collector::allocations();
+    if (void *memory = std::malloc(size == 0 ? 1 : size))
+    {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void operator delete(void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void *memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
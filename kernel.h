@@ -0,0 +1,376 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SEMANTIC_KERNEL_X86 1
+#include <immintrin.h>
+#endif
+
+namespace kernel
+{
+enum class Feature
+{
+    scalar,
+    avx2,
+    avx512
+};
+
+inline auto detect() -> Feature
+{
+#if defined(SEMANTIC_KERNEL_X86)
+    static const Feature feature = []() -> Feature {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+        {
+            return Feature::avx512;
+        }
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return Feature::avx2;
+        }
+        return Feature::scalar;
+    }();
+    return feature;
+#else
+    return Feature::scalar;
+#endif
+}
+
+template <typename T, typename D>
+inline constexpr bool preservesOrder = std::is_same_v<T, D> || std::is_floating_point_v<D> ||
+                                       (std::is_integral_v<T> && std::is_integral_v<D> && !std::is_same_v<D, bool> &&
+                                        (std::is_signed_v<T> ? std::is_signed_v<D> && sizeof(D) >= sizeof(T) : !std::is_signed_v<D> ? sizeof(D) >= sizeof(T) : sizeof(D) > sizeof(T)));
+
+template <typename D, typename T>
+auto summateScalar(const T *data, std::size_t size) -> D
+{
+    D lanes[8] = {D{}, D{}, D{}, D{}, D{}, D{}, D{}, D{}};
+    std::size_t index = 0;
+    for (; index + 8 <= size; index += 8)
+    {
+        for (std::size_t lane = 0; lane < 8; ++lane)
+        {
+            lanes[lane] += static_cast<D>(data[index + lane]);
+        }
+    }
+    for (; index < size; ++index)
+    {
+        lanes[index & 7] += static_cast<D>(data[index]);
+    }
+    return ((lanes[0] + lanes[4]) + (lanes[2] + lanes[6])) + ((lanes[1] + lanes[5]) + (lanes[3] + lanes[7]));
+}
+
+template <typename T, typename Select>
+auto selectScalar(const T *data, std::size_t size, Select &&select) -> T
+{
+    T lanes[4] = {data[0], data[0], data[0], data[0]};
+    std::size_t index = 0;
+    for (; index + 4 <= size; index += 4)
+    {
+        for (std::size_t lane = 0; lane < 4; ++lane)
+        {
+            lanes[lane] = select(lanes[lane], data[index + lane]);
+        }
+    }
+    for (; index < size; ++index)
+    {
+        lanes[0] = select(lanes[0], data[index]);
+    }
+    return select(select(lanes[0], lanes[1]), select(lanes[2], lanes[3]));
+}
+
+#if defined(SEMANTIC_KERNEL_X86)
+__attribute__((target("avx2"))) inline auto summateAvx2(const double *data, std::size_t size) -> double
+{
+    __m256d a = _mm256_setzero_pd(), b = _mm256_setzero_pd(), c = _mm256_setzero_pd(), d = _mm256_setzero_pd();
+    std::size_t index = 0;
+    for (; index + 16 <= size; index += 16)
+    {
+        a = _mm256_add_pd(a, _mm256_loadu_pd(data + index));
+        b = _mm256_add_pd(b, _mm256_loadu_pd(data + index + 4));
+        c = _mm256_add_pd(c, _mm256_loadu_pd(data + index + 8));
+        d = _mm256_add_pd(d, _mm256_loadu_pd(data + index + 12));
+    }
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, _mm256_add_pd(_mm256_add_pd(a, b), _mm256_add_pd(c, d)));
+    return (lanes[0] + lanes[2]) + (lanes[1] + lanes[3]) + summateScalar<double>(data + index, size - index);
+}
+
+__attribute__((target("avx2"))) inline auto summateAvx2(const float *data, std::size_t size) -> float
+{
+    __m256 a = _mm256_setzero_ps(), b = _mm256_setzero_ps(), c = _mm256_setzero_ps(), d = _mm256_setzero_ps();
+    std::size_t index = 0;
+    for (; index + 32 <= size; index += 32)
+    {
+        a = _mm256_add_ps(a, _mm256_loadu_ps(data + index));
+        b = _mm256_add_ps(b, _mm256_loadu_ps(data + index + 8));
+        c = _mm256_add_ps(c, _mm256_loadu_ps(data + index + 16));
+        d = _mm256_add_ps(d, _mm256_loadu_ps(data + index + 24));
+    }
+    alignas(32) float lanes[8];
+    _mm256_store_ps(lanes, _mm256_add_ps(_mm256_add_ps(a, b), _mm256_add_ps(c, d)));
+    return summateScalar<float>(lanes, 8) + summateScalar<float>(data + index, size - index);
+}
+
+__attribute__((target("avx512f"))) inline auto summateAvx512(const double *data, std::size_t size) -> double
+{
+    __m512d a = _mm512_setzero_pd(), b = _mm512_setzero_pd(), c = _mm512_setzero_pd(), d = _mm512_setzero_pd();
+    std::size_t index = 0;
+    for (; index + 32 <= size; index += 32)
+    {
+        a = _mm512_add_pd(a, _mm512_loadu_pd(data + index));
+        b = _mm512_add_pd(b, _mm512_loadu_pd(data + index + 8));
+        c = _mm512_add_pd(c, _mm512_loadu_pd(data + index + 16));
+        d = _mm512_add_pd(d, _mm512_loadu_pd(data + index + 24));
+    }
+    alignas(64) double lanes[8];
+    _mm512_store_pd(lanes, _mm512_add_pd(_mm512_add_pd(a, b), _mm512_add_pd(c, d)));
+    return summateScalar<double>(lanes, 8) + summateScalar<double>(data + index, size - index);
+}
+
+__attribute__((target("avx512f"))) inline auto summateAvx512(const float *data, std::size_t size) -> float
+{
+    __m512 a = _mm512_setzero_ps(), b = _mm512_setzero_ps(), c = _mm512_setzero_ps(), d = _mm512_setzero_ps();
+    std::size_t index = 0;
+    for (; index + 64 <= size; index += 64)
+    {
+        a = _mm512_add_ps(a, _mm512_loadu_ps(data + index));
+        b = _mm512_add_ps(b, _mm512_loadu_ps(data + index + 16));
+        c = _mm512_add_ps(c, _mm512_loadu_ps(data + index + 32));
+        d = _mm512_add_ps(d, _mm512_loadu_ps(data + index + 48));
+    }
+    alignas(64) float lanes[16];
+    _mm512_store_ps(lanes, _mm512_add_ps(_mm512_add_ps(a, b), _mm512_add_ps(c, d)));
+    return summateScalar<float>(lanes, 16) + summateScalar<float>(data + index, size - index);
+}
+
+__attribute__((target("avx2"))) inline auto extremaAvx2(const double *data, std::size_t size) -> std::pair<double, double>
+{
+    __m256d low = _mm256_set1_pd(data[0]), high = low, lowNext = low, highNext = low;
+    std::size_t index = 0;
+    for (; index + 8 <= size; index += 8)
+    {
+        __m256d first = _mm256_loadu_pd(data + index);
+        __m256d second = _mm256_loadu_pd(data + index + 4);
+        low = _mm256_min_pd(low, first);
+        high = _mm256_max_pd(high, first);
+        lowNext = _mm256_min_pd(lowNext, second);
+        highNext = _mm256_max_pd(highNext, second);
+    }
+    alignas(32) double lows[4];
+    alignas(32) double highs[4];
+    _mm256_store_pd(lows, _mm256_min_pd(low, lowNext));
+    _mm256_store_pd(highs, _mm256_max_pd(high, highNext));
+    double minimum = std::min(std::min(lows[0], lows[1]), std::min(lows[2], lows[3]));
+    double maximum = std::max(std::max(highs[0], highs[1]), std::max(highs[2], highs[3]));
+    for (; index < size; ++index)
+    {
+        minimum = std::min(minimum, data[index]);
+        maximum = std::max(maximum, data[index]);
+    }
+    return std::make_pair(minimum, maximum);
+}
+
+__attribute__((target("avx2"))) inline auto extremaAvx2(const float *data, std::size_t size) -> std::pair<float, float>
+{
+    __m256 low = _mm256_set1_ps(data[0]), high = low, lowNext = low, highNext = low;
+    std::size_t index = 0;
+    for (; index + 16 <= size; index += 16)
+    {
+        __m256 first = _mm256_loadu_ps(data + index);
+        __m256 second = _mm256_loadu_ps(data + index + 8);
+        low = _mm256_min_ps(low, first);
+        high = _mm256_max_ps(high, first);
+        lowNext = _mm256_min_ps(lowNext, second);
+        highNext = _mm256_max_ps(highNext, second);
+    }
+    alignas(32) float lows[8];
+    alignas(32) float highs[8];
+    _mm256_store_ps(lows, _mm256_min_ps(low, lowNext));
+    _mm256_store_ps(highs, _mm256_max_ps(high, highNext));
+    float minimum = *std::min_element(lows, lows + 8);
+    float maximum = *std::max_element(highs, highs + 8);
+    for (; index < size; ++index)
+    {
+        minimum = std::min(minimum, data[index]);
+        maximum = std::max(maximum, data[index]);
+    }
+    return std::make_pair(minimum, maximum);
+}
+
+__attribute__((target("avx512f"))) inline auto extremaAvx512(const double *data, std::size_t size) -> std::pair<double, double>
+{
+    __m512d low = _mm512_set1_pd(data[0]), high = low, lowNext = low, highNext = low;
+    std::size_t index = 0;
+    for (; index + 16 <= size; index += 16)
+    {
+        __m512d first = _mm512_loadu_pd(data + index);
+        __m512d second = _mm512_loadu_pd(data + index + 8);
+        low = _mm512_mask_min_pd(low, 0xFF, low, first);
+        high = _mm512_mask_max_pd(high, 0xFF, high, first);
+        lowNext = _mm512_mask_min_pd(lowNext, 0xFF, lowNext, second);
+        highNext = _mm512_mask_max_pd(highNext, 0xFF, highNext, second);
+    }
+    alignas(64) double lows[8];
+    alignas(64) double highs[8];
+    _mm512_store_pd(lows, _mm512_mask_min_pd(low, 0xFF, low, lowNext));
+    _mm512_store_pd(highs, _mm512_mask_max_pd(high, 0xFF, high, highNext));
+    double minimum = *std::min_element(lows, lows + 8);
+    double maximum = *std::max_element(highs, highs + 8);
+    for (; index < size; ++index)
+    {
+        minimum = std::min(minimum, data[index]);
+        maximum = std::max(maximum, data[index]);
+    }
+    return std::make_pair(minimum, maximum);
+}
+
+__attribute__((target("avx512f"))) inline auto extremaAvx512(const float *data, std::size_t size) -> std::pair<float, float>
+{
+    __m512 low = _mm512_set1_ps(data[0]), high = low, lowNext = low, highNext = low;
+    std::size_t index = 0;
+    for (; index + 32 <= size; index += 32)
+    {
+        __m512 first = _mm512_loadu_ps(data + index);
+        __m512 second = _mm512_loadu_ps(data + index + 16);
+        low = _mm512_mask_min_ps(low, 0xFFFF, low, first);
+        high = _mm512_mask_max_ps(high, 0xFFFF, high, first);
+        lowNext = _mm512_mask_min_ps(lowNext, 0xFFFF, lowNext, second);
+        highNext = _mm512_mask_max_ps(highNext, 0xFFFF, highNext, second);
+    }
+    alignas(64) float lows[16];
+    alignas(64) float highs[16];
+    _mm512_store_ps(lows, _mm512_mask_min_ps(low, 0xFFFF, low, lowNext));
+    _mm512_store_ps(highs, _mm512_mask_max_ps(high, 0xFFFF, high, highNext));
+    float minimum = *std::min_element(lows, lows + 16);
+    float maximum = *std::max_element(highs, highs + 16);
+    for (; index < size; ++index)
+    {
+        minimum = std::min(minimum, data[index]);
+        maximum = std::max(maximum, data[index]);
+    }
+    return std::make_pair(minimum, maximum);
+}
+#endif
+
+template <typename D, typename T>
+auto summate(const T *data, std::size_t size) -> D
+{
+#if defined(SEMANTIC_KERNEL_X86)
+    if constexpr (std::is_same_v<T, D> && (std::is_same_v<T, double> || std::is_same_v<T, float>))
+    {
+        switch (detect())
+        {
+        case Feature::avx512:
+            return summateAvx512(data, size);
+        case Feature::avx2:
+            return summateAvx2(data, size);
+        default:
+            break;
+        }
+    }
+#endif
+    return summateScalar<D>(data, size);
+}
+
+template <typename D, typename T>
+auto compensatedSummate(const T *data, std::size_t size) -> std::pair<D, D>
+{
+    if constexpr (std::is_integral_v<D>)
+    {
+        return std::make_pair(summateScalar<D>(data, size), D{});
+    }
+    else
+    {
+        D sums[4] = {D{}, D{}, D{}, D{}};
+        D compensations[4] = {D{}, D{}, D{}, D{}};
+        for (std::size_t index = 0; index < size; ++index)
+        {
+            std::size_t lane = index & 3;
+            D value = static_cast<D>(data[index]);
+            D total = sums[lane] + value;
+            if (std::abs(sums[lane]) >= std::abs(value))
+            {
+                compensations[lane] += (sums[lane] - total) + value;
+            }
+            else
+            {
+                compensations[lane] += (value - total) + sums[lane];
+            }
+            sums[lane] = total;
+        }
+        D sum = D{};
+        D compensation = compensations[0] + compensations[1] + compensations[2] + compensations[3];
+        for (std::size_t lane = 0; lane < 4; ++lane)
+        {
+            D total = sum + sums[lane];
+            if (std::abs(sum) >= std::abs(sums[lane]))
+            {
+                compensation += (sum - total) + sums[lane];
+            }
+            else
+            {
+                compensation += (sums[lane] - total) + sum;
+            }
+            sum = total;
+        }
+        return std::make_pair(sum, compensation);
+    }
+}
+
+template <typename T>
+auto extrema(const T *data, std::size_t size) -> std::pair<T, T>
+{
+#if defined(SEMANTIC_KERNEL_X86)
+    if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>)
+    {
+        switch (detect())
+        {
+        case Feature::avx512:
+            return extremaAvx512(data, size);
+        case Feature::avx2:
+            return extremaAvx2(data, size);
+        default:
+            break;
+        }
+    }
+#endif
+    return std::make_pair(selectScalar(data, size, [](const T &a, const T &b) -> T { return b < a ? b : a; }),
+                          selectScalar(data, size, [](const T &a, const T &b) -> T { return a < b ? b : a; }));
+}
+
+template <typename T>
+auto minimum(const T *data, std::size_t size) -> T
+{
+#if defined(SEMANTIC_KERNEL_X86)
+    if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>)
+    {
+        if (detect() != Feature::scalar)
+        {
+            return extrema(data, size).first;
+        }
+    }
+#endif
+    return selectScalar(data, size, [](const T &a, const T &b) -> T { return b < a ? b : a; });
+}
+
+template <typename T>
+auto maximum(const T *data, std::size_t size) -> T
+{
+#if defined(SEMANTIC_KERNEL_X86)
+    if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>)
+    {
+        if (detect() != Feature::scalar)
+        {
+            return extrema(data, size).second;
+        }
+    }
+#endif
+    return selectScalar(data, size, [](const T &a, const T &b) -> T { return a < b ? b : a; });
+}
+
+} // namespace kernel
@@ -1,24 +1,1161 @@
 #pragma once
 #include <vector>
+#include <deque>
+#include <array>
 #include <queue>
 #include <mutex>
 #include <atomic>
 #include <thread>
 #include <future>
 #include <memory>
+#include <functional>
 #include <condition_variable>
 #include <stdexcept>
 #include <iostream>
+#include <cstdint>
+#include <exception>
+#include <algorithm>
+#include <optional>
+#include <new>
+#include <cstddef>
+#include <type_traits>
+#include <chrono>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <utility>
+#include <limits>
+#if defined(__cpp_impl_coroutine)
+#include <coroutine>
+#endif
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#ifndef SEMANTIC_POOL_METRICS
+#define SEMANTIC_POOL_METRICS 0
+#endif
 
 namespace pool
 {
-class ThreadPool
+using Clock = std::chrono::steady_clock;
+
+class Task
+{
+  private:
+    static constexpr std::size_t capacity = 6 * sizeof(void *);
+
+    struct Operations
+    {
+        void (*invoke)(void *);
+        void (*relocate)(void *, void *);
+        void (*destroy)(void *);
+    };
+
+    template <typename F>
+    static auto local() -> const Operations *
+    {
+        static const Operations operations{
+            [](void *storage) { (*static_cast<F *>(storage))(); },
+            [](void *target, void *source) {
+                new (target) F(std::move(*static_cast<F *>(source)));
+                static_cast<F *>(source)->~F();
+            },
+            [](void *storage) { static_cast<F *>(storage)->~F(); }};
+        return &operations;
+    }
+
+    template <typename F>
+    static auto remote() -> const Operations *
+    {
+        static const Operations operations{
+            [](void *storage) { (**static_cast<F **>(storage))(); },
+            [](void *target, void *source) { *static_cast<F **>(target) = *static_cast<F **>(source); },
+            [](void *storage) { delete *static_cast<F **>(storage); }};
+        return &operations;
+    }
+
+    alignas(std::max_align_t) unsigned char storage[capacity];
+    const Operations *operations = nullptr;
+#if SEMANTIC_POOL_METRICS
+    Clock::time_point queued{};
+#endif
+
+  public:
+    Task() = default;
+
+    template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Task>>>
+    Task(F &&function)
+    {
+        using Callable = std::decay_t<F>;
+        if constexpr (sizeof(Callable) <= capacity && alignof(Callable) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<Callable>)
+        {
+            new (storage) Callable(std::forward<F>(function));
+            operations = local<Callable>();
+        }
+        else
+        {
+            *reinterpret_cast<Callable **>(storage) = new Callable(std::forward<F>(function));
+            operations = remote<Callable>();
+        }
+    }
+
+    Task(const Task &) = delete;
+    Task &operator=(const Task &) = delete;
+
+    Task(Task &&other) noexcept : operations(other.operations)
+    {
+#if SEMANTIC_POOL_METRICS
+        queued = other.queued;
+#endif
+        if (operations != nullptr)
+        {
+            operations->relocate(storage, other.storage);
+            other.operations = nullptr;
+        }
+    }
+
+    Task &operator=(Task &&other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            operations = other.operations;
+#if SEMANTIC_POOL_METRICS
+            queued = other.queued;
+#endif
+            if (operations != nullptr)
+            {
+                operations->relocate(storage, other.storage);
+                other.operations = nullptr;
+            }
+        }
+        return *this;
+    }
+
+    ~Task()
+    {
+        reset();
+    }
+
+    void reset()
+    {
+        if (operations != nullptr)
+        {
+            operations->destroy(storage);
+            operations = nullptr;
+        }
+    }
+
+    explicit operator bool() const
+    {
+        return operations != nullptr;
+    }
+
+    void operator()()
+    {
+        operations->invoke(storage);
+    }
+
+#if SEMANTIC_POOL_METRICS
+    void stamp(Clock::time_point time)
+    {
+        queued = time;
+    }
+
+    auto stamped() const -> Clock::time_point
+    {
+        return queued;
+    }
+#endif
+};
+
+#if SEMANTIC_POOL_METRICS
+struct Distribution
+{
+    static constexpr std::size_t width = 48;
+
+    std::uint64_t count = 0;
+    std::uint64_t total = 0;
+    std::array<std::uint64_t, width> buckets{};
+
+    auto mean() const -> double
+    {
+        return count == 0 ? 0.0 : static_cast<double>(total) / static_cast<double>(count);
+    }
+
+    auto percentile(double fraction) const -> std::uint64_t
+    {
+        std::uint64_t rank = static_cast<std::uint64_t>(fraction * static_cast<double>(count));
+        std::uint64_t seen = 0;
+        for (std::size_t index = 0; index < width; ++index)
+        {
+            seen += buckets[index];
+            if (seen > rank)
+            {
+                return (std::uint64_t{1} << index) - 1;
+            }
+        }
+        return count == 0 ? 0 : (std::uint64_t{1} << (width - 1)) - 1;
+    }
+};
+
+struct WorkerMetrics
+{
+    std::size_t index;
+    std::size_t node;
+    std::uint64_t executed;
+    std::uint64_t steals;
+    std::uint64_t busy;
+    std::uint64_t alive;
+
+    auto utilization() const -> double
+    {
+        return alive == 0 ? 0.0 : std::min(1.0, static_cast<double>(busy) / static_cast<double>(alive));
+    }
+};
+
+struct Metrics
+{
+    std::uint64_t submitted = 0;
+    std::uint64_t completed = 0;
+    std::uint64_t dropped = 0;
+    std::uint64_t steals = 0;
+    std::size_t depth = 0;
+    Distribution wait;
+    Distribution run;
+    std::vector<WorkerMetrics> workers;
+};
+
+inline std::ostream &operator<<(std::ostream &stream, const Distribution &distribution)
+{
+    return stream << "count=" << distribution.count << " mean=" << static_cast<std::uint64_t>(distribution.mean()) << "ns p50<=" << distribution.percentile(0.5) << "ns p99<=" << distribution.percentile(0.99) << "ns";
+}
+
+inline std::ostream &operator<<(std::ostream &stream, const Metrics &metrics)
+{
+    stream << "submitted=" << metrics.submitted << " completed=" << metrics.completed << " dropped=" << metrics.dropped << " steals=" << metrics.steals << " depth=" << metrics.depth << "\n";
+    stream << "wait: " << metrics.wait << "\n";
+    stream << "run: " << metrics.run << "\n";
+    for (const WorkerMetrics &worker : metrics.workers)
+    {
+        stream << "worker " << worker.index << " node=" << worker.node << " executed=" << worker.executed << " steals=" << worker.steals << " busy=" << std::fixed << std::setprecision(1) << worker.utilization() * 100.0 << "%\n";
+    }
+    return stream;
+}
+#endif
+
+enum class Priority : std::size_t
+{
+    high,
+    normal,
+    low
+};
+
+class Deque
+{
+  private:
+    struct Ring
+    {
+        std::int64_t capacity;
+        std::unique_ptr<std::atomic<Task *>[]> items;
+
+        explicit Ring(std::int64_t capacity) : capacity(capacity), items(new std::atomic<Task *>[capacity])
+        {
+        }
+
+        auto get(std::int64_t index) const -> Task *
+        {
+            return items[index & (capacity - 1)].load(std::memory_order_relaxed);
+        }
+
+        void put(std::int64_t index, Task *task)
+        {
+            items[index & (capacity - 1)].store(task, std::memory_order_relaxed);
+        }
+    };
+
+    std::atomic<std::int64_t> top{0};
+    std::atomic<std::int64_t> bottom{0};
+    std::atomic<Ring *> ring;
+    std::vector<std::unique_ptr<Ring>> rings;
+
+    auto grow(Ring *current, std::int64_t from, std::int64_t to) -> Ring *
+    {
+        rings.emplace_back(std::make_unique<Ring>(current->capacity * 2));
+        Ring *next = rings.back().get();
+        for (std::int64_t index = from; index < to; ++index)
+        {
+            next->put(index, current->get(index));
+        }
+        ring.store(next, std::memory_order_release);
+        return next;
+    }
+
+  public:
+    explicit Deque(std::int64_t capacity = 64)
+    {
+        rings.emplace_back(std::make_unique<Ring>(capacity));
+        ring.store(rings.back().get(), std::memory_order_relaxed);
+    }
+
+    Deque(const Deque &) = delete;
+    Deque &operator=(const Deque &) = delete;
+
+    void localize()
+    {
+        if (!empty())
+        {
+            return;
+        }
+        Ring *current = ring.load(std::memory_order_relaxed);
+        rings.emplace_back(std::make_unique<Ring>(current->capacity));
+        ring.store(rings.back().get(), std::memory_order_release);
+    }
+
+    void push(Task *task)
+    {
+        std::int64_t b = bottom.load(std::memory_order_relaxed);
+        std::int64_t t = top.load(std::memory_order_acquire);
+        Ring *current = ring.load(std::memory_order_relaxed);
+        if (b - t > current->capacity - 1)
+        {
+            current = grow(current, t, b);
+        }
+        current->put(b, task);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    auto pop() -> Task *
+    {
+        std::int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        Ring *current = ring.load(std::memory_order_relaxed);
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t t = top.load(std::memory_order_relaxed);
+        if (t > b)
+        {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        Task *task = current->get(b);
+        if (t == b)
+        {
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                task = nullptr;
+            }
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return task;
+    }
+
+    auto steal() -> Task *
+    {
+        std::int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t b = bottom.load(std::memory_order_acquire);
+        if (t >= b)
+        {
+            return nullptr;
+        }
+        Ring *current = ring.load(std::memory_order_acquire);
+        Task *task = current->get(t);
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return nullptr;
+        }
+        return task;
+    }
+
+    auto empty() const -> bool
+    {
+        return bottom.load(std::memory_order_relaxed) <= top.load(std::memory_order_relaxed);
+    }
+};
+
+class Cancelled : public std::runtime_error
+{
+  public:
+    Cancelled() : std::runtime_error("Operation cancelled.") {}
+};
+
+class Expired : public std::runtime_error
+{
+  public:
+    Expired() : std::runtime_error("Task deadline expired before it started.") {}
+};
+
+template <typename R>
+class Expiring
+{
+  private:
+    std::function<R()> body;
+    std::promise<R> promise;
+    bool armed = true;
+
+  public:
+    explicit Expiring(std::function<R()> body) : body(std::move(body)) {}
+
+    Expiring(Expiring &&other) noexcept : body(std::move(other.body)), promise(std::move(other.promise)), armed(std::exchange(other.armed, false)) {}
+
+    Expiring &operator=(Expiring &&) = delete;
+
+    ~Expiring()
+    {
+        if (armed)
+        {
+            promise.set_exception(std::make_exception_ptr(Expired()));
+        }
+    }
+
+    auto future() -> std::future<R>
+    {
+        return promise.get_future();
+    }
+
+    void operator()()
+    {
+        armed = false;
+        try
+        {
+            if constexpr (std::is_void_v<R>)
+            {
+                body();
+                promise.set_value();
+            }
+            else
+            {
+                promise.set_value(body());
+            }
+        }
+        catch (...)
+        {
+            promise.set_exception(std::current_exception());
+        }
+    }
+};
+
+class CancellationToken
+{
+  private:
+    std::shared_ptr<std::atomic<bool>> state = std::make_shared<std::atomic<bool>>(false);
+
+    static auto scoped() -> const CancellationToken *&
+    {
+        static thread_local const CancellationToken *current = nullptr;
+        return current;
+    }
+
+    friend class CancellationScope;
+
+  public:
+    void cancel() const
+    {
+        state->store(true, std::memory_order_release);
+    }
+
+    auto cancelled() const -> bool
+    {
+        return state->load(std::memory_order_acquire);
+    }
+
+    void check() const
+    {
+        if (cancelled())
+        {
+            throw Cancelled();
+        }
+    }
+
+    static auto current() -> const CancellationToken *
+    {
+        return scoped();
+    }
+};
+
+class CancellationScope
+{
+  private:
+    const CancellationToken *previous;
+
+  public:
+    explicit CancellationScope(const CancellationToken *token) : previous(CancellationToken::scoped())
+    {
+        CancellationToken::scoped() = token;
+    }
+
+    explicit CancellationScope(const CancellationToken &token) : CancellationScope(&token) {}
+
+    CancellationScope(const CancellationScope &) = delete;
+    CancellationScope &operator=(const CancellationScope &) = delete;
+
+    ~CancellationScope()
+    {
+        CancellationToken::scoped() = previous;
+    }
+};
+
+class Group
+{
+  private:
+    std::atomic<std::size_t> remaining{0};
+    std::atomic<bool> settled{true};
+    std::exception_ptr failure;
+    std::mutex failureMutex;
+    std::mutex parkMutex;
+    std::condition_variable parked;
+    const CancellationToken *token;
+
+  public:
+    explicit Group(const CancellationToken *token = CancellationToken::current()) : token(token)
+    {
+    }
+
+    Group(const Group &) = delete;
+    Group &operator=(const Group &) = delete;
+
+    void add(std::size_t count)
+    {
+        if (remaining.fetch_add(count, std::memory_order_relaxed) == 0 && count > 0)
+        {
+            std::lock_guard<std::mutex> lock(parkMutex);
+            settled.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    void done(std::size_t count = 1)
+    {
+        if (remaining.fetch_sub(count, std::memory_order_acq_rel) == count)
+        {
+            std::lock_guard<std::mutex> lock(parkMutex);
+            if (remaining.load(std::memory_order_acquire) == 0)
+            {
+                settled.store(true, std::memory_order_release);
+                parked.notify_all();
+            }
+        }
+    }
+
+    void park(std::chrono::nanoseconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(parkMutex);
+        parked.wait_for(lock, timeout, [this] { return settled.load(std::memory_order_acquire); });
+    }
+
+    void settle()
+    {
+        while (!settled.load(std::memory_order_acquire))
+        {
+            park(std::chrono::milliseconds(1));
+        }
+        std::lock_guard<std::mutex> lock(parkMutex);
+    }
+
+    void fail(std::exception_ptr exception)
+    {
+        std::lock_guard<std::mutex> lock(failureMutex);
+        if (!failure)
+        {
+            failure = exception;
+        }
+    }
+
+    auto finished() const -> bool
+    {
+        return remaining.load(std::memory_order_acquire) == 0;
+    }
+
+    auto failed() -> bool
+    {
+        std::lock_guard<std::mutex> lock(failureMutex);
+        return static_cast<bool>(failure);
+    }
+
+    auto stopped() -> bool
+    {
+        return (token != nullptr && token->cancelled()) || failed();
+    }
+
+    auto cancellation() const -> const CancellationToken *
+    {
+        return token;
+    }
+
+    void rethrow()
+    {
+        std::lock_guard<std::mutex> lock(failureMutex);
+        if (failure)
+        {
+            std::rethrow_exception(failure);
+        }
+        if (token != nullptr)
+        {
+            token->check();
+        }
+    }
+};
+
+class Executor
+{
+  public:
+    virtual ~Executor() = default;
+
+    virtual void execute(Task task) = 0;
+
+    virtual void parallelFor(std::size_t begin, std::size_t end, const std::function<void(std::size_t, std::size_t)> &body, std::size_t step = 0) = 0;
+
+    virtual auto concurrency() const -> std::size_t = 0;
+
+    template <typename A>
+    auto parallelReduce(std::size_t begin, std::size_t end, A identity, const std::function<A(std::size_t, std::size_t)> &mapper, const std::function<A(A, A)> &combiner, std::size_t step = 0) -> A
+    {
+        if (begin >= end)
+        {
+            return identity;
+        }
+        std::size_t chunk = step == 0 ? (end - begin + concurrency() * 4 - 1) / (concurrency() * 4) : step;
+        std::vector<std::optional<A>> partials((end - begin + chunk - 1) / chunk);
+        parallelFor(begin, end, [&partials, &mapper, begin, chunk](std::size_t from, std::size_t to) {
+            partials[(from - begin) / chunk].emplace(mapper(from, to));
+        },
+                    chunk);
+        A result = std::move(identity);
+        for (auto &partial : partials)
+        {
+            result = combiner(std::move(result), std::move(partial.value()));
+        }
+        return result;
+    }
+};
+
+template <typename T>
+class Channel
+{
+  private:
+    std::vector<std::optional<T>> cells;
+    std::size_t mask;
+    alignas(64) std::atomic<std::size_t> head{0};
+    alignas(64) std::atomic<std::size_t> tail{0};
+    std::atomic<bool> closed{false};
+    std::atomic<bool> aborted{false};
+    std::atomic<std::size_t> waiting{0};
+    std::mutex mutex;
+    std::condition_variable condition;
+
+    static auto round(std::size_t capacity) -> std::size_t
+    {
+        std::size_t size = 1;
+        while (size < capacity)
+        {
+            size <<= 1;
+        }
+        return size;
+    }
+
+    template <typename Ready>
+    void block(Ready &&ready)
+    {
+        for (std::size_t attempt = 0; attempt < 64; ++attempt)
+        {
+            if (ready())
+            {
+                return;
+            }
+            std::this_thread::yield();
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        ++waiting;
+        condition.wait(lock, ready);
+        --waiting;
+    }
+
+    void signal()
+    {
+        if (waiting.load() > 0)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+            }
+            condition.notify_all();
+        }
+    }
+
+  public:
+    explicit Channel(std::size_t capacity) : cells(round(std::max<std::size_t>(1, capacity))), mask(cells.size() - 1)
+    {
+    }
+
+    Channel(const Channel &) = delete;
+    Channel &operator=(const Channel &) = delete;
+
+    auto push(T value) -> bool
+    {
+        std::size_t position = tail.load(std::memory_order_relaxed);
+        block([this, position] {
+            return position - head.load() < cells.size() || aborted.load();
+        });
+        if (aborted.load())
+        {
+            return false;
+        }
+        cells[position & mask].emplace(std::move(value));
+        tail.store(position + 1);
+        signal();
+        return true;
+    }
+
+    auto pop() -> std::optional<T>
+    {
+        std::size_t position = head.load(std::memory_order_relaxed);
+        block([this, position] {
+            return tail.load() != position || closed.load() || aborted.load();
+        });
+        if (tail.load() == position || aborted.load())
+        {
+            return std::nullopt;
+        }
+        std::optional<T> value = std::move(cells[position & mask]);
+        cells[position & mask].reset();
+        head.store(position + 1);
+        signal();
+        return value;
+    }
+
+    void close()
+    {
+        closed.store(true);
+        signal();
+    }
+
+    void abort()
+    {
+        aborted.store(true);
+        signal();
+    }
+
+    auto cancelled() const -> bool
+    {
+        return aborted.load();
+    }
+};
+
+#if defined(__cpp_impl_coroutine)
+template <typename R>
+class Awaitable
+{
+  private:
+    Executor *executor;
+    std::function<R()> work;
+    std::optional<R> value;
+    std::exception_ptr failure;
+
+  public:
+    Awaitable(Executor &executor, std::function<R()> work) : executor(&executor), work(std::move(work))
+    {
+    }
+
+    auto await_ready() const noexcept -> bool
+    {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        executor->execute(Task([this, handle] {
+            try
+            {
+                value.emplace(work());
+            }
+            catch (...)
+            {
+                failure = std::current_exception();
+            }
+            handle.resume();
+        }));
+    }
+
+    auto await_resume() -> R
+    {
+        if (failure)
+        {
+            std::rethrow_exception(failure);
+        }
+        return std::move(*value);
+    }
+};
+#endif
+
+enum class Placement
+{
+    none,
+    compact,
+    spread
+};
+
+struct IdleStrategy
+{
+    std::size_t spins = std::thread::hardware_concurrency() > 1 ? 128 : 0;
+    std::size_t yields = 4;
+};
+
+struct Elasticity
+{
+    std::size_t minimum = 1;
+    std::size_t maximum = std::max(1u, std::thread::hardware_concurrency());
+    std::chrono::nanoseconds threshold = std::chrono::milliseconds(1);
+    std::chrono::nanoseconds keepAlive = std::chrono::seconds(1);
+};
+
+class Topology
+{
+  public:
+    struct Core
+    {
+        std::size_t cpu;
+        std::size_t node;
+    };
+
+  private:
+    std::vector<Core> available;
+    std::size_t nodeCount = 1;
+
+    static auto parse(const std::string &list) -> std::vector<std::size_t>
+    {
+        std::vector<std::size_t> cpus;
+        std::stringstream stream(list);
+        std::string range;
+        while (std::getline(stream, range, ','))
+        {
+            if (range.empty())
+            {
+                continue;
+            }
+            std::size_t dash = range.find('-');
+            std::size_t first = std::stoul(range.substr(0, dash));
+            std::size_t last = dash == std::string::npos ? first : std::stoul(range.substr(dash + 1));
+            for (std::size_t cpu = first; cpu <= last; ++cpu)
+            {
+                cpus.push_back(cpu);
+            }
+        }
+        return cpus;
+    }
+
+    Topology()
+    {
+#if defined(__linux__)
+        cpu_set_t mask;
+        CPU_ZERO(&mask);
+        if (sched_getaffinity(0, sizeof(mask), &mask) == 0)
+        {
+            for (std::size_t cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+            {
+                if (CPU_ISSET(cpu, &mask))
+                {
+                    available.push_back(Core{cpu, 0});
+                }
+            }
+        }
+        for (std::size_t node = 0;; ++node)
+        {
+            std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+            if (!file)
+            {
+                break;
+            }
+            std::string list;
+            std::getline(file, list);
+            for (std::size_t cpu : parse(list))
+            {
+                for (Core &core : available)
+                {
+                    if (core.cpu == cpu)
+                    {
+                        core.node = node;
+                    }
+                }
+            }
+            nodeCount = node + 1;
+        }
+#endif
+        if (available.empty())
+        {
+            std::size_t count = std::max(1u, std::thread::hardware_concurrency());
+            for (std::size_t cpu = 0; cpu < count; ++cpu)
+            {
+                available.push_back(Core{cpu, 0});
+            }
+        }
+    }
+
+  public:
+    static auto instance() -> const Topology &
+    {
+        static const Topology topology;
+        return topology;
+    }
+
+    auto cores() const -> const std::vector<Core> &
+    {
+        return available;
+    }
+
+    auto nodes() const -> std::size_t
+    {
+        return nodeCount;
+    }
+
+    auto order(Placement placement, const std::vector<std::size_t> &cpus) const -> std::vector<Core>
+    {
+        std::vector<Core> chosen;
+        for (const Core &core : available)
+        {
+            if (cpus.empty() || std::find(cpus.begin(), cpus.end(), core.cpu) != cpus.end())
+            {
+                chosen.push_back(core);
+            }
+        }
+        std::stable_sort(chosen.begin(), chosen.end(), [](const Core &a, const Core &b) {
+            return a.node < b.node;
+        });
+        if (placement != Placement::spread)
+        {
+            return chosen;
+        }
+        std::vector<std::vector<Core>> groups(nodeCount);
+        for (const Core &core : chosen)
+        {
+            groups[core.node].push_back(core);
+        }
+        std::vector<Core> spread;
+        for (std::size_t round = 0; spread.size() < chosen.size(); ++round)
+        {
+            for (const std::vector<Core> &group : groups)
+            {
+                if (round < group.size())
+                {
+                    spread.push_back(group[round]);
+                }
+            }
+        }
+        return spread;
+    }
+
+    static auto pin(std::size_t cpu) -> bool
+    {
+#if defined(__linux__)
+        cpu_set_t mask;
+        CPU_ZERO(&mask);
+        CPU_SET(cpu, &mask);
+        return pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask) == 0;
+#else
+        (void)cpu;
+        return false;
+#endif
+    }
+};
+
+class ThreadPool;
+
+class Batch
+{
+  private:
+    ThreadPool *pool;
+    std::shared_ptr<Group> group;
+
+  public:
+    Batch(ThreadPool *pool, std::shared_ptr<Group> group) : pool(pool), group(std::move(group))
+    {
+    }
+
+    Batch(const Batch &) = delete;
+    Batch &operator=(const Batch &) = delete;
+    Batch(Batch &&) noexcept = default;
+    Batch &operator=(Batch &&) noexcept = default;
+
+    auto ready() const -> bool
+    {
+        return !group || group->finished();
+    }
+
+    void wait();
+};
+
+class ThreadPool : public Executor
 {
   private:
-    std::vector<std::thread> workers;
-    std::queue<std::function<void()>> tasks;
+    template <typename F>
+    struct Bulk : Group
+    {
+        F body;
+
+        explicit Bulk(F &&body) : Group(nullptr), body(std::move(body))
+        {
+        }
+    };
+
+    struct Loop : Group
+    {
+        const std::function<void(std::size_t, std::size_t)> &body;
+        std::size_t begin;
+        std::size_t end;
+        std::size_t chunk;
+        std::size_t chunks;
+        std::atomic<std::size_t> next{0};
+
+        Loop(const std::function<void(std::size_t, std::size_t)> &body, std::size_t begin, std::size_t end, std::size_t chunk)
+            : body(body), begin(begin), end(end), chunk(chunk), chunks((end - begin + chunk - 1) / chunk)
+        {
+        }
+
+        auto claim() -> bool
+        {
+            std::size_t index = next.fetch_add(1, std::memory_order_relaxed);
+            if (index >= chunks)
+            {
+                return false;
+            }
+            if (!stopped())
+            {
+                try
+                {
+                    CancellationScope scope(cancellation());
+                    std::size_t from = begin + index * chunk;
+                    body(from, std::min(from + chunk, end));
+                }
+                catch (...)
+                {
+                    fail(std::current_exception());
+                }
+            }
+            done();
+            return true;
+        }
+    };
+
+#if SEMANTIC_POOL_METRICS
+    class Recorder
+    {
+      private:
+        std::array<std::atomic<std::uint64_t>, Distribution::width> buckets{};
+        std::atomic<std::uint64_t> count{0};
+        std::atomic<std::uint64_t> total{0};
+
+      public:
+        void record(std::uint64_t nanoseconds)
+        {
+            std::size_t index = 0;
+            while (index + 1 < Distribution::width && (nanoseconds >> index) != 0)
+            {
+                ++index;
+            }
+            buckets[index].fetch_add(1, std::memory_order_relaxed);
+            count.fetch_add(1, std::memory_order_relaxed);
+            total.fetch_add(nanoseconds, std::memory_order_relaxed);
+        }
+
+        void collect(Distribution &distribution) const
+        {
+            for (std::size_t index = 0; index < Distribution::width; ++index)
+            {
+                distribution.buckets[index] += buckets[index].load(std::memory_order_relaxed);
+            }
+            distribution.count += count.load(std::memory_order_relaxed);
+            distribution.total += total.load(std::memory_order_relaxed);
+        }
+    };
+
+    struct Meter
+    {
+        Recorder wait;
+        Recorder run;
+        std::atomic<std::uint64_t> submitted{0};
+        std::atomic<std::uint64_t> executed{0};
+        std::atomic<std::uint64_t> steals{0};
+        std::atomic<std::uint64_t> busy{0};
+    };
+#endif
+
+    struct Slot
+    {
+        std::thread thread;
+        Deque deque;
+        std::size_t node = 0;
+#if SEMANTIC_POOL_METRICS
+        Meter meter;
+        std::atomic<std::int64_t> started{0};
+        std::atomic<std::uint64_t> busyBase{0};
+#endif
+        bool occupied = false;
+        std::atomic<bool> finished{false};
+    };
+
+    struct Context
+    {
+        ThreadPool *pool;
+        Slot *slot;
+        std::uint64_t seed;
+    };
+
+    static constexpr std::size_t capacity = 256;
+
+    std::array<std::atomic<Slot *>, capacity> slots{};
+    std::atomic<std::size_t> slotCount{0};
+    std::size_t workerCount = 0;
+    std::atomic<std::size_t> live{0};
+    std::vector<Topology::Core> layout;
+#if SEMANTIC_POOL_METRICS
+    Meter outside;
+    std::atomic<std::uint64_t> dropped{0};
+
+    auto meter(Context &current) -> Meter &
+    {
+        return current.pool == this && current.slot != nullptr ? current.slot->meter : outside;
+    }
+
+    static auto elapsed(Clock::time_point from, Clock::time_point to) -> std::uint64_t
+    {
+        return to > from ? static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count()) : 0;
+    }
+#endif
+
+    std::atomic<bool> elastic{false};
+    std::atomic<std::size_t> elasticMinimum{0};
+    std::atomic<std::size_t> elasticMaximum{0};
+    std::atomic<std::int64_t> threshold{0};
+    std::atomic<std::int64_t> keepAlive{0};
+    std::thread monitor;
+    std::mutex monitorMutex;
+    std::condition_variable monitorCondition;
+    bool monitoring = false;
+    struct Entry
+    {
+        Task task;
+        Priority priority;
+        Clock::time_point deadline;
+        Clock::time_point enqueued;
+        std::uint64_t sequence;
+    };
+
+    std::array<std::deque<Entry>, 3> lanes;
+    std::vector<Entry> deadlines;
+    std::uint64_t sequence = 0;
+    std::atomic<std::size_t> injected{0};
+    std::atomic<std::int64_t> horizon{std::numeric_limits<std::int64_t>::max()};
+    std::atomic<std::int64_t> aging{std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::milliseconds(10)).count()};
+    std::atomic<std::size_t> pending{0};
+    std::atomic<std::size_t> sleeping{0};
+    std::atomic<std::size_t> retiring{0};
+    std::atomic<std::uint64_t> epoch{0};
+    std::atomic<std::size_t> spins{IdleStrategy().spins};
+    std::atomic<std::size_t> yields{IdleStrategy().yields};
     std::mutex queueMutex;
     std::mutex workersMutex;
+    std::mutex parkMutex;
     std::atomic<bool> active{true};
     std::atomic<bool> emergency{false};
     std::condition_variable condition;
@@ -27,54 +1164,650 @@ class ThreadPool
     std::condition_variable exitCondition;
     std::atomic<std::size_t> exitingCount{0};
 
-    void workerLoop()
+    static auto context() -> Context &
+    {
+        static thread_local Context current{nullptr, nullptr, 0};
+        return current;
+    }
+
+    struct Cache
+    {
+        std::vector<Task *> nodes;
+
+        ~Cache()
+        {
+            for (Task *node : nodes)
+            {
+                delete node;
+            }
+        }
+    };
+
+    static constexpr std::size_t cacheLimit = 1024;
+
+    static auto cache() -> std::vector<Task *> &
+    {
+        static thread_local Cache current;
+        return current.nodes;
+    }
+
+    static auto allocate(Task &&task) -> Task *
+    {
+#if SEMANTIC_POOL_METRICS
+        task.stamp(Clock::now());
+#endif
+        std::vector<Task *> &nodes = cache();
+        if (nodes.empty())
+        {
+            return new Task(std::move(task));
+        }
+        Task *node = nodes.back();
+        nodes.pop_back();
+        *node = std::move(task);
+        return node;
+    }
+
+    static void recycle(Task *node)
+    {
+        node->reset();
+        std::vector<Task *> &nodes = cache();
+        if (nodes.size() < cacheLimit)
+        {
+            nodes.push_back(node);
+        }
+        else
+        {
+            delete node;
+        }
+    }
+
+    static auto random(Context &current) -> std::uint64_t
+    {
+        if (current.seed == 0)
+        {
+            current.seed = std::hash<std::thread::id>()(std::this_thread::get_id()) | 1ULL;
+        }
+        current.seed ^= current.seed << 13;
+        current.seed ^= current.seed >> 7;
+        current.seed ^= current.seed << 17;
+        return current.seed;
+    }
+
+    static auto later(const Entry &a, const Entry &b) -> bool
+    {
+        if (a.deadline != b.deadline)
+        {
+            return a.deadline > b.deadline;
+        }
+        return a.sequence > b.sequence;
+    }
+
+    static auto rank(const Entry &entry, Clock::time_point now, std::int64_t interval) -> std::int64_t
+    {
+        std::int64_t waited = std::chrono::duration_cast<std::chrono::nanoseconds>(now - entry.enqueued).count();
+        return static_cast<std::int64_t>(entry.priority) - (interval > 0 ? waited / interval : 0);
+    }
+
+    void refresh()
+    {
+        std::int64_t interval = aging.load();
+        std::int64_t earliest = std::numeric_limits<std::int64_t>::max();
+        auto consider = [&earliest, interval](const Entry &entry) {
+            std::int64_t level = static_cast<std::int64_t>(entry.priority);
+            if (level > 0 && interval <= 0)
+            {
+                return;
+            }
+            Clock::time_point ripe = entry.enqueued + std::chrono::nanoseconds(level * interval);
+            earliest = std::min<std::int64_t>(earliest, ripe.time_since_epoch().count());
+        };
+        for (const std::deque<Entry> &lane : lanes)
+        {
+            if (!lane.empty())
+            {
+                consider(lane.front());
+            }
+        }
+        if (!deadlines.empty())
+        {
+            consider(deadlines.front());
+        }
+        horizon.store(earliest, std::memory_order_relaxed);
+    }
+
+    auto due() const -> bool
+    {
+        return injected.load(std::memory_order_relaxed) > 0 && Clock::now().time_since_epoch().count() >= horizon.load(std::memory_order_relaxed);
+    }
+
+    void enqueue(Task &&task, Priority priority, Clock::time_point deadline, Clock::time_point now)
+    {
+#if SEMANTIC_POOL_METRICS
+        task.stamp(now);
+#endif
+        if (deadline == Clock::time_point::max())
+        {
+            lanes[static_cast<std::size_t>(priority)].push_back(Entry{std::move(task), priority, deadline, now, sequence++});
+        }
+        else
+        {
+            deadlines.push_back(Entry{std::move(task), priority, deadline, now, sequence++});
+            std::push_heap(deadlines.begin(), deadlines.end(), later);
+        }
+        ++injected;
+        refresh();
+    }
+
+    auto inject(Task &task, bool ripeOnly) -> bool
+    {
+        if (injected.load() == 0)
+        {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(queueMutex);
+        Clock::time_point now = Clock::now();
+        std::int64_t interval = aging.load();
+        while (true)
+        {
+            const std::size_t none = lanes.size() + 1;
+            std::size_t chosen = none;
+            std::int64_t best = 0;
+            if (!deadlines.empty())
+            {
+                chosen = lanes.size();
+                best = rank(deadlines.front(), now, interval);
+            }
+            for (std::size_t index = 0; index < lanes.size(); ++index)
+            {
+                if (lanes[index].empty())
+                {
+                    continue;
+                }
+                std::int64_t candidate = rank(lanes[index].front(), now, interval);
+                if (chosen == none || candidate < best)
+                {
+                    chosen = index;
+                    best = candidate;
+                }
+            }
+            if (chosen == none || (ripeOnly && best > 0))
+            {
+                return false;
+            }
+            Entry entry;
+            if (chosen == lanes.size())
+            {
+                std::pop_heap(deadlines.begin(), deadlines.end(), later);
+                entry = std::move(deadlines.back());
+                deadlines.pop_back();
+            }
+            else
+            {
+                entry = std::move(lanes[chosen].front());
+                lanes[chosen].pop_front();
+            }
+            --injected;
+            refresh();
+            if (entry.deadline < now)
+            {
+#if SEMANTIC_POOL_METRICS
+                dropped.fetch_add(1, std::memory_order_relaxed);
+#endif
+                --pending;
+                continue;
+            }
+            task = std::move(entry.task);
+            return true;
+        }
+    }
+
+    auto steal(Context &current) -> Task *
+    {
+        std::size_t count = slotCount.load(std::memory_order_acquire);
+        if (count == 0)
+        {
+            return nullptr;
+        }
+        std::size_t start = static_cast<std::size_t>(random(current) % count);
+        bool local = current.slot != nullptr && !layout.empty();
+        for (std::size_t pass = local ? 0 : 1; pass < 2; ++pass)
+        {
+            for (std::size_t offset = 0; offset < count; ++offset)
+            {
+                Slot *victim = slots[(start + offset) % count].load(std::memory_order_acquire);
+                if (victim == nullptr || victim == current.slot || (local && (victim->node == current.slot->node) != (pass == 0)))
+                {
+                    continue;
+                }
+                Task *task = victim->deque.steal();
+                if (task != nullptr)
+                {
+#if SEMANTIC_POOL_METRICS
+                    meter(current).steals.fetch_add(1, std::memory_order_relaxed);
+#endif
+                    return task;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    auto acquire(Context &current, Task &task) -> bool
+    {
+        if (due() && inject(task, true))
+        {
+            --pending;
+            return true;
+        }
+        Task *node = nullptr;
+        if (current.pool == this && current.slot != nullptr)
+        {
+            node = current.slot->deque.pop();
+        }
+        if (node == nullptr && inject(task, false))
+        {
+            --pending;
+            return true;
+        }
+        if (node == nullptr && pending.load() > 0)
+        {
+            node = steal(current);
+        }
+        if (node == nullptr)
+        {
+            return false;
+        }
+        --pending;
+        task = std::move(*node);
+        recycle(node);
+        return true;
+    }
+
+    void run(Task &task)
+    {
+#if SEMANTIC_POOL_METRICS
+        Meter &current = meter(context());
+        Clock::time_point start = Clock::now();
+        current.wait.record(elapsed(task.stamped(), start));
+#endif
+        try
+        {
+            task();
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << e.what() << std::endl;
+        }
+        catch (...)
+        {
+            std::cerr << "Unknown exception in worker thread." << std::endl;
+        }
+#if SEMANTIC_POOL_METRICS
+        std::uint64_t duration = elapsed(start, Clock::now());
+        current.run.record(duration);
+        current.executed.fetch_add(1, std::memory_order_relaxed);
+        current.busy.fetch_add(duration, std::memory_order_relaxed);
+#endif
+    }
+
+    void schedule(Task &&task, Priority priority = Priority::normal, Clock::time_point deadline = Clock::time_point::max())
+    {
+        Context &current = context();
+        ++pending;
+        try
+        {
+            if (priority == Priority::normal && deadline == Clock::time_point::max() && current.pool == this && current.slot != nullptr && active.load() && !emergency.load())
+            {
+                current.slot->deque.push(allocate(std::move(task)));
+            }
+            else
+            {
+                std::lock_guard<std::mutex> lock(queueMutex);
+                if (!active.load() || emergency.load())
+                {
+                    throw std::runtime_error("ThreadPool is not active.");
+                }
+                enqueue(std::move(task), priority, deadline, Clock::now());
+            }
+        }
+        catch (...)
+        {
+            --pending;
+            throw;
+        }
+#if SEMANTIC_POOL_METRICS
+        meter(current).submitted.fetch_add(1, std::memory_order_relaxed);
+#endif
+        wake(1);
+    }
+
+    template <typename Make>
+    void scheduleBulk(std::size_t count, Make &&make)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+        Context &current = context();
+        std::size_t published = 0;
+        pending += count;
+        try
+        {
+            if (current.pool == this && current.slot != nullptr && active.load() && !emergency.load())
+            {
+                for (; published < count; ++published)
+                {
+                    current.slot->deque.push(allocate(make(published)));
+                }
+            }
+            else
+            {
+                std::lock_guard<std::mutex> lock(queueMutex);
+                if (!active.load() || emergency.load())
+                {
+                    throw std::runtime_error("ThreadPool is not active.");
+                }
+                Clock::time_point now = Clock::now();
+                for (; published < count; ++published)
+                {
+                    enqueue(make(published), Priority::normal, Clock::time_point::max(), now);
+                }
+            }
+        }
+        catch (...)
+        {
+            pending -= count - published;
+            if (published > 0)
+            {
+                wake(published);
+            }
+            throw;
+        }
+#if SEMANTIC_POOL_METRICS
+        meter(current).submitted.fetch_add(count, std::memory_order_relaxed);
+#endif
+        wake(count);
+    }
+
+    static void pause()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+
+    void wake(std::size_t count)
+    {
+        epoch.fetch_add(1);
+        std::size_t idle = sleeping.load();
+        if (idle == 0)
+        {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(parkMutex);
+        }
+        if (count >= idle)
+        {
+            condition.notify_all();
+            return;
+        }
+        for (std::size_t index = 0; index < count; ++index)
+        {
+            condition.notify_one();
+        }
+    }
+
+    auto retire() -> bool
     {
-        while (true)
+        std::size_t requests = retiring.load();
+        while (requests > 0)
         {
-            std::function<void()> task;
+            if (retiring.compare_exchange_weak(requests, requests - 1))
             {
-                std::unique_lock<std::mutex> lock(queueMutex);
-                condition.wait(lock, [this] {
-                    return !tasks.empty() || !active.load() || emergency.load();
-                });
-                if (emergency.load())
-                {
-                    notifyExit();
-                    return;
-                }
-                if (!active.load() && tasks.empty())
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void drain(Slot *slot)
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        Clock::time_point now = Clock::now();
+        while (Task *node = slot->deque.pop())
+        {
+            enqueue(std::move(*node), Priority::normal, Clock::time_point::max(), now);
+            recycle(node);
+        }
+    }
+
+    void workerLoop(Slot *slot, std::uint64_t seed)
+    {
+        Context &current = context();
+        current = Context{this, slot, seed};
+        Task task;
+        while (!emergency.load())
+        {
+            if (retiring.load() > 0 && retire())
+            {
+                drain(slot);
+                --live;
+                current = Context{nullptr, nullptr, 0};
+                slot->finished.store(true);
+                notifyExit();
+                wake(capacity);
+                return;
+            }
+            if (acquire(current, task))
+            {
+                run(task);
+                task.reset();
+                continue;
+            }
+            if (!active.load() && pending.load() == 0)
+            {
+                break;
+            }
+            if (idle())
+            {
+                continue;
+            }
+            ++sleeping;
+            std::uint64_t key = epoch.load();
+            auto awake = [this, key] {
+                return epoch.load() != key || pending.load() > 0 || retiring.load() > 0 || !active.load() || emergency.load();
+            };
+            std::unique_lock<std::mutex> lock(parkMutex);
+            if (elastic.load())
+            {
+                if (!condition.wait_for(lock, std::chrono::nanoseconds(keepAlive.load()), awake) && shrink())
                 {
-                    notifyExit();
+                    --sleeping;
+                    lock.unlock();
+                    current = Context{nullptr, nullptr, 0};
+                    slot->finished.store(true);
                     return;
                 }
-                if (tasks.empty())
-                {
-                    continue;
-                }
-                task = std::move(tasks.front());
-                tasks.pop();
             }
-            try
+            else
             {
-                task();
+                condition.wait(lock, awake);
+            }
+            --sleeping;
+            lock.unlock();
+            if (!active.load() && pending.load() == 0)
+            {
+                break;
             }
-            catch (const std::exception &e)
+        }
+        --live;
+        current = Context{nullptr, nullptr, 0};
+        slot->finished.store(true);
+    }
+
+    auto idle() -> bool
+    {
+        auto awake = [this] {
+            return pending.load(std::memory_order_relaxed) > 0 || retiring.load(std::memory_order_relaxed) > 0 || !active.load(std::memory_order_relaxed);
+        };
+        for (std::size_t index = spins.load(std::memory_order_relaxed); index > 0; --index)
+        {
+            if (awake())
             {
-                std::cerr << e.what() << std::endl;
+                return true;
             }
-            catch (...)
+            pause();
+        }
+        for (std::size_t index = yields.load(std::memory_order_relaxed); index > 0; --index)
+        {
+            if (awake())
+            {
+                return true;
+            }
+            std::this_thread::yield();
+        }
+        return false;
+    }
+
+    auto shrink() -> bool
+    {
+        if (!elastic.load())
+        {
+            return false;
+        }
+        std::size_t count = live.load();
+        while (count > elasticMinimum.load())
+        {
+            if (live.compare_exchange_weak(count, count - 1))
+            {
+                targetSize.store(count - 1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void reap()
+    {
+        std::size_t count = slotCount.load();
+        for (std::size_t index = 0; index < count; ++index)
+        {
+            Slot *slot = slots[index].load();
+            if (slot->occupied && slot->finished.load() && slot->thread.joinable())
+            {
+                slot->thread.join();
+                slot->occupied = false;
+                --workerCount;
+            }
+        }
+    }
+
+    auto backlog(Clock::time_point now) -> Clock::duration
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        Clock::time_point oldest = now;
+        for (const std::deque<Entry> &lane : lanes)
+        {
+            if (!lane.empty())
+            {
+                oldest = std::min(oldest, lane.front().enqueued);
+            }
+        }
+        for (const Entry &entry : deadlines)
+        {
+            oldest = std::min(oldest, entry.enqueued);
+        }
+        return now - oldest;
+    }
+
+    void adjust(Clock::time_point &busySince)
+    {
+        std::lock_guard<std::mutex> lock(workersMutex);
+        reap();
+        if (!active.load() || emergency.load())
+        {
+            return;
+        }
+        Clock::time_point now = Clock::now();
+        if (pending.load() == 0 || sleeping.load() > 0)
+        {
+            busySince = now;
+        }
+        Clock::duration waited = std::max(backlog(now), now - busySince);
+        std::size_t count = live.load();
+        bool starving = waited > std::chrono::nanoseconds(threshold.load()) && count < elasticMaximum.load();
+        if ((starving || count < elasticMinimum.load()) && workerCount < capacity)
+        {
+            addWorker();
+            targetSize.store(live.load());
+            busySince = now;
+        }
+    }
+
+    void supervise()
+    {
+        Clock::time_point busySince = Clock::now();
+        std::unique_lock<std::mutex> lock(monitorMutex);
+        while (monitoring)
+        {
+            std::int64_t period = std::max<std::int64_t>(std::min(threshold.load(), keepAlive.load()) / 2, 100000);
+            monitorCondition.wait_for(lock, std::chrono::nanoseconds(period));
+            if (!monitoring)
             {
-                std::cerr << "Unknown exception in worker thread." << std::endl;
+                break;
             }
+            lock.unlock();
+            adjust(busySince);
+            lock.lock();
+        }
+    }
+
+    void stopMonitor()
+    {
+        {
+            std::lock_guard<std::mutex> lock(monitorMutex);
+            monitoring = false;
+        }
+        monitorCondition.notify_all();
+        if (monitor.joinable())
+        {
+            monitor.join();
         }
     }
 
     void notifyExit()
     {
-        ++exitingCount;
+        {
+            std::lock_guard<std::mutex> lock(exitMutex);
+            ++exitingCount;
+        }
         exitCondition.notify_one();
     }
 
+    void join()
+    {
+        std::size_t count = slotCount.load();
+        for (std::size_t index = 0; index < count; ++index)
+        {
+            Slot *slot = slots[index].load();
+            if (slot->occupied && slot->thread.joinable())
+            {
+                slot->thread.join();
+            }
+            slot->occupied = false;
+        }
+        workerCount = 0;
+    }
+
+    auto grain(std::size_t size) const -> std::size_t
+    {
+        std::size_t chunks = std::max<std::size_t>(1, targetSize.load() * 4);
+        return std::max<std::size_t>(1, (size + chunks - 1) / chunks);
+    }
+
   public:
     ThreadPool(const ThreadPool &) = delete;
     ThreadPool &operator=(const ThreadPool &) = delete;
@@ -83,10 +1816,27 @@ class ThreadPool
 
     ~ThreadPool()
     {
+        stopMonitor();
         if (active.load())
         {
             shutdown();
         }
+        {
+            std::lock_guard<std::mutex> lock(workersMutex);
+            join();
+        }
+        for (auto &entry : slots)
+        {
+            Slot *slot = entry.load();
+            if (slot != nullptr)
+            {
+                while (Task *node = slot->deque.pop())
+                {
+                    delete node;
+                }
+                delete slot;
+            }
+        }
     }
 
     explicit ThreadPool(std::size_t size = std::thread::hardware_concurrency())
@@ -99,41 +1849,133 @@ class ThreadPool
         }
     }
 
+    ThreadPool(std::size_t size, Placement placement, const std::vector<std::size_t> &cpus = {})
+        : targetSize(size)
+    {
+        if (placement != Placement::none || !cpus.empty())
+        {
+            layout = Topology::instance().order(placement, cpus);
+            if (layout.empty())
+            {
+                throw std::invalid_argument("ThreadPool placement has no usable CPU.");
+            }
+        }
+        std::lock_guard<std::mutex> lock(workersMutex);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            addWorker();
+        }
+    }
+
     void addWorker()
     {
-        workers.emplace_back([this] { workerLoop(); });
+        std::size_t count = slotCount.load();
+        std::size_t index = 0;
+        while (index < count && slots[index].load()->occupied)
+        {
+            ++index;
+        }
+        bool fresh = index == count;
+        if (fresh)
+        {
+            if (count == capacity)
+            {
+                throw std::runtime_error("ThreadPool capacity exceeded.");
+            }
+            Slot *created = new Slot();
+            if (!layout.empty())
+            {
+                created->node = layout[index % layout.size()].node;
+            }
+            slots[index].store(created, std::memory_order_release);
+            slotCount.store(count + 1, std::memory_order_release);
+        }
+        Slot *slot = slots[index].load();
+        slot->occupied = true;
+        slot->finished.store(false);
+#if SEMANTIC_POOL_METRICS
+        slot->started.store(Clock::now().time_since_epoch().count());
+        slot->busyBase.store(slot->meter.busy.load());
+#endif
+        std::uint64_t seed = 0x9E3779B97F4A7C15ULL * (index + 1);
+        ++live;
+        std::optional<std::size_t> cpu;
+        if (!layout.empty())
+        {
+            cpu = layout[index % layout.size()].cpu;
+        }
+        slot->thread = std::thread([this, slot, seed, cpu, fresh] {
+            if (cpu.has_value() && Topology::pin(*cpu) && fresh)
+            {
+                slot->deque.localize();
+            }
+            workerLoop(slot, seed);
+        });
+        ++workerCount;
     }
 
     void increase()
     {
         std::lock_guard<std::mutex> lock(workersMutex);
         addWorker();
-        targetSize.store(workers.size());
+        targetSize.store(workerCount);
+    }
+
+    void setIdleStrategy(const IdleStrategy &strategy)
+    {
+        spins.store(strategy.spins);
+        yields.store(strategy.yields);
+    }
+
+    void setElasticity(const Elasticity &policy)
+    {
+        if (policy.minimum == 0 || policy.minimum > policy.maximum || policy.maximum > capacity)
+        {
+            throw std::invalid_argument("Invalid ThreadPool elasticity bounds.");
+        }
+        stopMonitor();
+        elasticMinimum.store(policy.minimum);
+        elasticMaximum.store(policy.maximum);
+        threshold.store(policy.threshold.count());
+        keepAlive.store(policy.keepAlive.count());
+        elastic.store(true);
+        monitoring = true;
+        monitor = std::thread([this] { supervise(); });
+    }
+
+    void clearElasticity()
+    {
+        stopMonitor();
+        elastic.store(false);
     }
 
     void decrease()
     {
         std::unique_lock<std::mutex> workersLock(workersMutex);
-        if (workers.empty())
+        if (workerCount == 0 || !active.load())
         {
             return;
         }
-        targetSize.store(workers.size() - 1);
-        workersLock.unlock();
+        targetSize.store(workerCount - 1);
 
         std::unique_lock<std::mutex> exitLock(exitMutex);
-        condition.notify_all();
+        ++retiring;
+        wake(capacity);
         exitCondition.wait(exitLock, [this] {
             return exitingCount.load() > 0;
         });
-        exitingCount.store(0);
+        --exitingCount;
+        exitLock.unlock();
 
-        workersLock.lock();
-        for (auto it = workers.begin(); it != workers.end(); ++it)
+        std::size_t count = slotCount.load();
+        for (std::size_t index = 0; index < count; ++index)
         {
-            if (!it->joinable())
+            Slot *slot = slots[index].load();
+            if (slot->occupied && slot->finished.load())
             {
-                workers.erase(it);
+                slot->thread.join();
+                slot->occupied = false;
+                --workerCount;
                 break;
             }
         }
@@ -141,18 +1983,19 @@ class ThreadPool
 
     void boot()
     {
-        if (!active.exchange(true))
+        if (active.exchange(true))
         {
             return;
         }
         emergency.store(false);
         std::size_t desired = targetSize.load();
         std::lock_guard<std::mutex> lock(workersMutex);
-        while (workers.size() < desired)
+        join();
+        while (workerCount < desired)
         {
             addWorker();
         }
-        condition.notify_all();
+        wake(capacity);
     }
 
     void shutdown()
@@ -161,66 +2004,288 @@ class ThreadPool
         {
             return;
         }
-        condition.notify_all();
+        wake(capacity);
         std::lock_guard<std::mutex> lock(workersMutex);
-        for (auto &worker : workers)
-        {
-            if (worker.joinable())
-            {
-                worker.join();
-            }
-        }
-        workers.clear();
+        join();
     }
 
     void emergencyShutdown()
     {
         emergency.store(true);
         active.store(false);
-        condition.notify_all();
+        wake(capacity);
         std::lock_guard<std::mutex> lock(workersMutex);
-        for (auto &worker : workers)
+        join();
+    }
+
+    auto help() -> bool
+    {
+        Context &current = context();
+        Task task;
+        if (current.pool != this || current.slot == nullptr || !acquire(current, task))
+        {
+            return false;
+        }
+        run(task);
+        return true;
+    }
+
+    void wait(Group &group)
+    {
+        std::size_t misses = 0;
+        while (!group.finished())
         {
-            if (worker.joinable())
+            if (help())
+            {
+                misses = 0;
+                continue;
+            }
+            if (misses < spins.load(std::memory_order_relaxed))
+            {
+                pause();
+            }
+            else if (misses < spins.load(std::memory_order_relaxed) + yields.load(std::memory_order_relaxed))
+            {
+                std::this_thread::yield();
+            }
+            else
             {
-                worker.join();
+                group.park(std::chrono::microseconds(200));
             }
+            ++misses;
         }
-        workers.clear();
+        group.settle();
+        group.rethrow();
     }
 
-    std::future<void> submit(std::function<void()> task)
+    void invokeAll(const std::vector<std::function<void()>> &bodies)
+    {
+        parallelFor(0, bodies.size(), [&bodies](std::size_t from, std::size_t to) {
+            for (std::size_t index = from; index < to; ++index)
+            {
+                bodies[index]();
+            }
+        },
+                    1);
+    }
+
+    void parallelFor(std::size_t begin, std::size_t end, const std::function<void(std::size_t, std::size_t)> &body, std::size_t step = 0) override
+    {
+        if (begin >= end)
+        {
+            return;
+        }
+        std::size_t chunk = step == 0 ? grain(end - begin) : step;
+        std::shared_ptr<Loop> loop = std::make_shared<Loop>(body, begin, end, chunk);
+        loop->add(loop->chunks);
+        try
+        {
+            scheduleBulk(std::min(loop->chunks - 1, concurrency()), [&loop](std::size_t index) -> Task {
+                return Task([loop] {
+                    while (loop->claim())
+                    {
+                    }
+                });
+            });
+        }
+        catch (...)
+        {
+            loop->fail(std::current_exception());
+        }
+        while (loop->claim())
+        {
+        }
+        wait(*loop);
+    }
+
+    static auto current() -> ThreadPool *
     {
-        auto packaged = std::make_shared<std::packaged_task<void()>>(task);
-        auto result = packaged->get_future();
+        return context().pool;
+    }
+
+#if SEMANTIC_POOL_METRICS
+    auto metrics() -> Metrics
+    {
+        Metrics snapshot;
+        Clock::time_point now = Clock::now();
+        auto gather = [&snapshot](const Meter &source) {
+            source.wait.collect(snapshot.wait);
+            source.run.collect(snapshot.run);
+            snapshot.submitted += source.submitted.load(std::memory_order_relaxed);
+            snapshot.completed += source.executed.load(std::memory_order_relaxed);
+            snapshot.steals += source.steals.load(std::memory_order_relaxed);
+        };
+        gather(outside);
+        std::lock_guard<std::mutex> lock(workersMutex);
+        std::size_t count = slotCount.load();
+        for (std::size_t index = 0; index < count; ++index)
         {
-            std::lock_guard<std::mutex> lock(queueMutex);
-            if (!active.load() || emergency.load())
+            Slot *slot = slots[index].load();
+            gather(slot->meter);
+            if (slot->occupied && !slot->finished.load())
             {
-                throw std::runtime_error("ThreadPool is not active.");
+                Clock::time_point started{Clock::duration(slot->started.load())};
+                snapshot.workers.push_back(WorkerMetrics{
+                    index,
+                    slot->node,
+                    slot->meter.executed.load(std::memory_order_relaxed),
+                    slot->meter.steals.load(std::memory_order_relaxed),
+                    slot->meter.busy.load(std::memory_order_relaxed) - slot->busyBase.load(),
+                    elapsed(started, now)});
             }
-            tasks.emplace([packaged] { (*packaged)(); });
         }
-        condition.notify_one();
+        snapshot.dropped = dropped.load(std::memory_order_relaxed);
+        snapshot.depth = pending.load();
+        return snapshot;
+    }
+#endif
+
+    static auto node() -> std::size_t
+    {
+        Context &current = context();
+        return current.slot != nullptr ? current.slot->node : 0;
+    }
+
+    auto concurrency() const -> std::size_t override
+    {
+        return std::max<std::size_t>(1, targetSize.load());
+    }
+
+    void execute(Task task) override
+    {
+        schedule(std::move(task));
+    }
+
+    template <typename F>
+    void execute(F &&task)
+    {
+        schedule(Task(std::forward<F>(task)));
+    }
+
+    template <typename F>
+    auto submitBulk(std::size_t count, F &&body) -> Batch
+    {
+        auto bulk = std::make_shared<Bulk<std::decay_t<F>>>(std::decay_t<F>(std::forward<F>(body)));
+        bulk->add(count);
+        try
+        {
+            scheduleBulk(count, [&bulk](std::size_t index) -> Task {
+                return Task([bulk, index] {
+                    if (!bulk->failed())
+                    {
+                        try
+                        {
+                            bulk->body(index);
+                        }
+                        catch (...)
+                        {
+                            bulk->fail(std::current_exception());
+                        }
+                    }
+                    bulk->done();
+                });
+            });
+        }
+        catch (...)
+        {
+            bulk->done(count);
+            throw;
+        }
+        return Batch(this, std::move(bulk));
+    }
+
+    auto submitAll(std::vector<std::function<void()>> bodies) -> Batch
+    {
+        std::size_t count = bodies.size();
+        return submitBulk(count, [bodies = std::move(bodies)](std::size_t index) { bodies[index](); });
+    }
+
+    template <typename F>
+    void execute(F &&task, Priority priority, Clock::time_point deadline = Clock::time_point::max())
+    {
+        schedule(Task(std::forward<F>(task)), priority, deadline);
+    }
+
+    void setAging(std::chrono::nanoseconds interval)
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        aging.store(interval.count());
+        refresh();
+    }
+
+    std::future<void> submit(std::function<void()> task)
+    {
+        return submit(std::move(task), Priority::normal);
+    }
+
+    std::future<void> submit(std::function<void()> task, const CancellationToken &token, Priority priority = Priority::normal)
+    {
+        return submit(
+            [task = std::move(task), token] {
+                token.check();
+                CancellationScope scope(token);
+                task();
+            },
+            priority);
+    }
+
+    std::future<void> submit(std::function<void()> task, Priority priority, Clock::time_point deadline = Clock::time_point::max())
+    {
+        if (deadline != Clock::time_point::max())
+        {
+            Expiring<void> expiring(std::move(task));
+            auto result = expiring.future();
+            schedule(Task(std::move(expiring)), priority, deadline);
+            return result;
+        }
+        std::packaged_task<void()> packaged(std::move(task));
+        auto result = packaged.get_future();
+        schedule(Task(std::move(packaged)), priority, deadline);
         return result;
     }
 
     template <typename R>
     std::future<R> submit(std::function<R()> task)
     {
-        auto packaged = std::make_shared<std::packaged_task<R()>>(task);
-        auto result = packaged->get_future();
+        return submit<R>(std::move(task), Priority::normal);
+    }
+
+    template <typename R>
+    std::future<R> submit(std::function<R()> task, const CancellationToken &token, Priority priority = Priority::normal)
+    {
+        return submit<R>(
+            [task = std::move(task), token]() -> R {
+                token.check();
+                CancellationScope scope(token);
+                return task();
+            },
+            priority);
+    }
+
+    template <typename R>
+    std::future<R> submit(std::function<R()> task, Priority priority, Clock::time_point deadline = Clock::time_point::max())
+    {
+        if (deadline != Clock::time_point::max())
         {
-            std::lock_guard<std::mutex> lock(queueMutex);
-            if (!active.load() || emergency.load())
-            {
-                throw std::runtime_error("ThreadPool is not active.");
-            }
-            tasks.emplace([packaged] { (*packaged)(); });
+            Expiring<R> expiring(std::move(task));
+            auto result = expiring.future();
+            schedule(Task(std::move(expiring)), priority, deadline);
+            return result;
         }
-        condition.notify_one();
+        std::packaged_task<R()> packaged(std::move(task));
+        auto result = packaged.get_future();
+        schedule(Task(std::move(packaged)), priority, deadline);
         return result;
     }
 };
 
-} // namespace pool
\ No newline at end of file
+inline void Batch::wait()
+{
+    if (group)
+    {
+        std::shared_ptr<Group> current = std::move(group);
+        pool->wait(*current);
+    }
+}
+
+} // namespace pool
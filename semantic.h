@@ -12,13 +12,16 @@
 #include <deque>
 #include <forward_list>
 #include <functional>
+#include <limits>
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <queue>
 #include <set>
 #include <stack>
+#include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
@@ -28,7 +31,82 @@ namespace semantic
 {
 template <typename E>
 class Semantic;
+
+enum class Characteristic : unsigned
+{
+    sized = 1U,
+    sorted = 2U,
+    distinct = 4U,
+    ordered = 8U
+};
+
+struct Characteristics
+{
+    unsigned flags = 0U;
+    function::Module size = 0;
+
+    auto has(const Characteristic &characteristic) const -> bool
+    {
+        return (flags & static_cast<unsigned>(characteristic)) != 0U;
+    }
+
+    auto with(const Characteristic &characteristic) const -> Characteristics
+    {
+        return Characteristics{flags | static_cast<unsigned>(characteristic), size};
+    }
+
+    auto sized(const function::Module &count) const -> Characteristics
+    {
+        return Characteristics{flags | static_cast<unsigned>(Characteristic::sized), count};
+    }
+
+    static auto of(std::initializer_list<Characteristic> characteristics) -> Characteristics
+    {
+        Characteristics result;
+        for (const Characteristic &characteristic : characteristics)
+        {
+            result.flags |= static_cast<unsigned>(characteristic);
+        }
+        return result;
+    }
+
+    auto keep(std::initializer_list<Characteristic> characteristics) const -> Characteristics
+    {
+        unsigned mask = 0U;
+        for (const Characteristic &characteristic : characteristics)
+        {
+            mask |= static_cast<unsigned>(characteristic);
+        }
+        return Characteristics{flags & mask, (flags & mask & static_cast<unsigned>(Characteristic::sized)) != 0U ? size : 0};
+    }
+};
+
+struct Plan
+{
+    std::string step;
+    std::string note;
+    std::shared_ptr<const Plan> upstream;
+};
+
+inline auto explain(const std::shared_ptr<const Plan> &plan) -> std::string
+{
+    std::vector<const Plan *> steps;
+    for (const Plan *node = plan.get(); node != nullptr; node = node->upstream.get())
+    {
+        steps.push_back(node);
+    }
+    std::string text = "source";
+    for (auto iterator = steps.rbegin(); iterator != steps.rend(); ++iterator)
+    {
+        text += " -> " + (*iterator)->step;
+        if (!(*iterator)->note.empty())
+        {
+            text += " [" + (*iterator)->note + "]";
+        }
+    }
+    return text;
 }
+} // namespace semantic
 
 namespace collectable
 {
@@ -37,9 +115,53 @@ class Collectable
 {
   protected:
     function::Module concurrent;
+    pool::Executor *executor;
+    std::shared_ptr<collector::Profile> profiler;
+    std::shared_ptr<const semantic::Plan> plan;
+
+    template <typename>
+    friend class semantic::Semantic;
+
+    virtual auto unordered() const -> function::Generator<E>
+    {
+        return this->source();
+    }
+
+    virtual auto extent() const -> std::optional<function::Module>
+    {
+        return std::nullopt;
+    }
+
+    template <typename A, typename R, typename Source>
+    auto perform(const char *name, const collector::Collector<E, A, R> &collectorValue, const Source &source) const -> R
+    {
+        if (this->profiler == nullptr)
+        {
+            if constexpr (std::is_same_v<Source, function::Generator<E>>)
+            {
+                return collectorValue.collect(source, this->concurrent, this->executor, this->extent().value_or(0));
+            }
+            else
+            {
+                return collectorValue.collect(source, this->concurrent, this->executor);
+            }
+        }
+        collector::Profile::Row &row = this->profiler->stage(name);
+        return collector::Profile::measure(row, [&]() -> R {
+            if constexpr (std::is_same_v<Source, function::Generator<E>>)
+            {
+                return collectorValue.collect(collector::Profile::tally(row, source), this->concurrent, this->executor, this->extent().value_or(0));
+            }
+            else
+            {
+                row.elements.fetch_add(source.size(), std::memory_order_relaxed);
+                return collectorValue.collect(source, this->concurrent, this->executor);
+            }
+        });
+    }
 
   public:
-    Collectable(const function::Module &concurrent) : concurrent(concurrent) {}
+    Collectable(const function::Module &concurrent, pool::Executor *executor = nullptr) : concurrent(concurrent), executor(executor) {}
 
     virtual ~Collectable() = default;
 
@@ -52,142 +174,212 @@ class Collectable
     auto allMatch(Predicate &&predicate) const -> bool
     {
         collector::Collector<E, bool, bool> collectorValue = collector::useAllMatch<E, Predicate>(std::forward<Predicate>(predicate));
-        return collectorValue.collect(this->source(), this->concurrent);
+        if constexpr (std::is_invocable_v<Predicate, E, function::Timestamp>)
+        {
+            return this->perform(__func__, collectorValue, this->source());
+        }
+        else
+        {
+            return this->perform(__func__, collectorValue, this->unordered());
+        }
     }
 
     template <typename Predicate>
     auto anyMatch(Predicate &&predicate) const -> bool
     {
         collector::Collector<E, bool, bool> collectorValue = collector::useAnyMatch<E, Predicate>(std::forward<Predicate>(predicate));
-        return collectorValue.collect(this->source(), this->concurrent);
+        if constexpr (std::is_invocable_v<Predicate, E, function::Timestamp>)
+        {
+            return this->perform(__func__, collectorValue, this->source());
+        }
+        else
+        {
+            return this->perform(__func__, collectorValue, this->unordered());
+        }
     }
 
     template <typename D>
     auto average() const -> D
     {
         collector::Collector<E, std::pair<D, function::Module>, D> collectorValue = collector::useAverage<E, D>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->unordered());
     }
 
     template <typename D>
     auto average(const function::Function<E, D> &mapper) const -> D
     {
         collector::Collector<E, std::pair<D, function::Module>, D> collectorValue = collector::useAverage<E, D>(mapper);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->unordered());
     }
 
     template <typename A, typename R>
     auto collect(const function::Supplier<R> &identity, const function::BiFunction<A, E, A> &accumulator, const function::BiFunction<A, A, A> &combiner, const function::Function<A, R> &finisher) const -> R
     {
         collector::Collector<E, A, R> collectorValue = collector::useCollect<E, A, R>(identity, accumulator, combiner, finisher);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     template <typename A, typename R>
     auto collect(const function::Supplier<R> &identity, const function::TriPredicate<E, function::Timestamp, A> &interrupt, const function::BiFunction<A, E, A> &accumulator, const function::BiFunction<A, A, A> &combiner, const function::Function<A, R> &finisher) const -> R
     {
         collector::Collector<E, A, R> collectorValue = collector::useCollect<E, A, R>(identity, interrupt, accumulator, combiner, finisher);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
+    }
+
+    template <typename A, typename R>
+    auto collectAsync(collector::Collector<E, A, R> collectorValue) const -> std::future<R>
+    {
+        return collectAsync(std::move(collectorValue), collector::currentExecutor(this->executor));
+    }
+
+    template <typename A, typename R>
+    auto collectAsync(collector::Collector<E, A, R> collectorValue, pool::Executor &executor) const -> std::future<R>
+    {
+        std::promise<R> promise;
+        std::future<R> result = promise.get_future();
+        executor.execute(pool::Task([promise = std::move(promise), collectorValue = std::move(collectorValue), generator = this->source(), concurrent = this->concurrent, target = &executor]() mutable {
+            try
+            {
+                promise.set_value(collectorValue.collect(generator, concurrent, target));
+            }
+            catch (...)
+            {
+                promise.set_exception(std::current_exception());
+            }
+        }));
+        return result;
     }
 
+#if defined(__cpp_impl_coroutine)
+    template <typename A, typename R>
+    auto collectAwait(collector::Collector<E, A, R> collectorValue) const -> pool::Awaitable<R>
+    {
+        return collectAwait(std::move(collectorValue), collector::currentExecutor(this->executor));
+    }
+
+    template <typename A, typename R>
+    auto collectAwait(collector::Collector<E, A, R> collectorValue, pool::Executor &executor) const -> pool::Awaitable<R>
+    {
+        auto shared = std::make_shared<collector::Collector<E, A, R>>(std::move(collectorValue));
+        return pool::Awaitable<R>(executor, [shared, generator = this->source(), concurrent = this->concurrent, target = &executor]() -> R {
+            return shared->collect(generator, concurrent, target);
+        });
+    }
+#endif
+
     auto count() const -> function::Module
     {
+        std::optional<function::Module> size = this->extent();
+        if (size.has_value() && this->profiler == nullptr)
+        {
+            return *size;
+        }
         collector::Collector<E, function::Module, function::Module> collectorValue = collector::useCount<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->unordered());
     }
 
     auto empty() const -> bool
     {
+        std::optional<function::Module> size = this->extent();
+        if (size.has_value() && this->profiler == nullptr)
+        {
+            return *size == 0;
+        }
         collector::Collector<E, function::Module, function::Module> collectorValue = collector::useCount<E>();
-        return collectorValue.collect(this->source(), this->concurrent) == 0;
+        return this->perform(__func__, collectorValue, this->unordered()) == 0;
     }
 
     auto error() const -> void
     {
         collector::Collector<E, charsequence::Builder, charsequence::Charsequence> collectorValue = collector::useError<E>();
-        collectorValue.collect(this->source(), this->concurrent);
+        this->perform(__func__, collectorValue, this->source());
     }
 
     auto error(const charsequence::Charsequence &delimiter) const -> void
     {
         collector::Collector<E, charsequence::Builder, charsequence::Charsequence> collectorValue = collector::useError<E>(delimiter);
-        collectorValue.collect(this->source(), this->concurrent);
+        this->perform(__func__, collectorValue, this->source());
     }
 
     auto error(const charsequence::Charsequence &prefix, const charsequence::Charsequence &delimiter, const charsequence::Charsequence &suffix) const -> void
     {
         collector::Collector<E, charsequence::Builder, charsequence::Charsequence> collectorValue = collector::useError<E>(prefix, delimiter, suffix);
-        collectorValue.collect(this->source(), this->concurrent);
+        this->perform(__func__, collectorValue, this->source());
     }
 
     template <typename Converter>
     auto error(const charsequence::Charsequence &prefix, Converter &&converter, const charsequence::Charsequence &suffix) const -> void
     {
         collector::Collector<E, charsequence::Builder, charsequence::Charsequence> collectorValue = collector::useError<E>(prefix, std::forward<Converter>(converter), suffix);
-        collectorValue.collect(this->source(), this->concurrent);
+        this->perform(__func__, collectorValue, this->source());
+    }
+
+    auto explain() const -> std::string
+    {
+        return semantic::explain(this->plan);
     }
 
     auto findAny() const -> std::optional<E>
     {
         collector::Collector<E, std::optional<E>, std::optional<E>> collectorValue = collector::useFindAny<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
-    auto findAt(const function::Timestamp &index) const -> std::optional<E>
+    virtual auto findAt(const function::Timestamp &index) const -> std::optional<E>
     {
         if (index >= 0LL)
         {
             collector::Collector<E, std::optional<E>, std::optional<E>> collectorValue = collector::useFindAt<E>(index);
-            return collectorValue.collect(this->source(), this->concurrent);
+            return this->perform(__func__, collectorValue, this->source());
         }
         else
         {
             collector::Collector<E, std::pair<std::vector<E>, function::Module>, std::optional<E>> collectorValue = collector::useFindNegativeAt<E>(index);
-            return collectorValue.collect(this->source(), this->concurrent);
+            return this->perform(__func__, collectorValue, this->source());
         }
     }
 
     auto findFirst() const -> std::optional<E>
     {
         collector::Collector<E, std::optional<E>, std::optional<E>> collectorValue = collector::useFindFirst<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto findLast() const -> std::optional<E>
     {
         collector::Collector<E, std::vector<E>, std::optional<E>> collectorValue = collector::useFindLast<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto findMaximum() const -> std::optional<E>
     {
         collector::Collector<E, std::optional<E>, std::optional<E>> collectorValue = collector::useFindMaximum<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto findMaximum(const function::Comparator<E> &comparator) const -> std::optional<E>
     {
         collector::Collector<E, std::optional<E>, std::optional<E>> collectorValue = collector::useFindMaximum<E>(comparator);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto findMinimum() const -> std::optional<E>
     {
         collector::Collector<E, std::optional<E>, std::optional<E>> collectorValue = collector::useFindMinimum<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto findMinimum(const function::Comparator<E> &comparator) const -> std::optional<E>
     {
         collector::Collector<E, std::optional<E>, std::optional<E>> collectorValue = collector::useFindMinimum<E>(comparator);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     template <typename Consumer>
     auto forEach(Consumer &&consumer) const -> void
     {
         collector::Collector<E, function::Module, function::Module> collectorValue = collector::useForEach<E, Consumer>(std::forward<Consumer>(consumer));
-        collectorValue.collect(this->source(), this->concurrent);
+        this->perform(__func__, collectorValue, this->source());
     }
 
     template <typename KeyExtractor>
@@ -195,7 +387,7 @@ class Collectable
     {
         using K = decltype(std::declval<KeyExtractor>()(std::declval<E>()));
         collector::Collector<E, std::unordered_map<K, std::vector<E>>, std::unordered_map<K, std::vector<E>>> collectorValue = collector::useGroup<E, K, KeyExtractor>(std::forward<KeyExtractor>(keyExtractor));
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     template <typename KeyExtractor, typename ValueExtractor>
@@ -204,77 +396,84 @@ class Collectable
         using K = decltype(std::declval<KeyExtractor>()(std::declval<E>()));
         using V = decltype(std::declval<ValueExtractor>()(std::declval<E>()));
         collector::Collector<E, std::unordered_map<K, std::vector<V>>, std::unordered_map<K, std::vector<V>>> collectorValue = collector::useGroupBy<E, K, V, KeyExtractor, ValueExtractor>(std::forward<KeyExtractor>(keyExtractor), std::forward<ValueExtractor>(valueExtractor));
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto join() const -> charsequence::Charsequence
     {
         collector::Collector<E, charsequence::Builder, charsequence::Charsequence> collectorValue = collector::useJoin<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto join(const charsequence::Charsequence &delimiter) const -> charsequence::Charsequence
     {
         collector::Collector<E, charsequence::Builder, charsequence::Charsequence> collectorValue = collector::useJoin<E>(delimiter);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto join(const charsequence::Charsequence &prefix, const charsequence::Charsequence &delimiter, const charsequence::Charsequence &suffix) const -> charsequence::Charsequence
     {
         collector::Collector<E, charsequence::Builder, charsequence::Charsequence> collectorValue = collector::useJoin<E>(prefix, delimiter, suffix);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     template <typename Converter>
     auto join(const charsequence::Charsequence &prefix, Converter &&converter, const charsequence::Charsequence &suffix) const -> charsequence::Charsequence
     {
         collector::Collector<E, charsequence::Builder, charsequence::Charsequence> collectorValue = collector::useJoin<E>(prefix, std::forward<Converter>(converter), suffix);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     template <typename Predicate>
     auto noneMatch(Predicate &&predicate) const -> bool
     {
         collector::Collector<E, bool, bool> collectorValue = collector::useNoneMatch<E>(std::forward<Predicate>(predicate));
-        return collectorValue.collect(this->source(), this->concurrent);
+        if constexpr (std::is_invocable_v<Predicate, E, function::Timestamp>)
+        {
+            return this->perform(__func__, collectorValue, this->source());
+        }
+        else
+        {
+            return this->perform(__func__, collectorValue, this->unordered());
+        }
     }
 
     auto out() const -> charsequence::Charsequence
     {
         collector::Collector<E, charsequence::Builder, charsequence::Charsequence> collectorValue = collector::useOut<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto out(const charsequence::Charsequence &delimiter) const -> charsequence::Charsequence
     {
         collector::Collector<E, charsequence::Builder, charsequence::Charsequence> collectorValue = collector::useOut<E>(delimiter);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto out(const charsequence::Charsequence &prefix, const charsequence::Charsequence &delimiter, const charsequence::Charsequence &suffix) const -> charsequence::Charsequence
     {
         collector::Collector<E, charsequence::Builder, charsequence::Charsequence> collectorValue = collector::useOut<E>(prefix, delimiter, suffix);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     template <typename Converter>
     auto out(const charsequence::Charsequence &prefix, Converter &&converter, const charsequence::Charsequence &suffix) const -> charsequence::Charsequence
     {
         collector::Collector<E, charsequence::Builder, charsequence::Charsequence> collectorValue = collector::useOut<E>(prefix, std::forward<Converter>(converter), suffix);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto partition(const function::Module &size) const -> std::vector<std::vector<E>>
     {
         collector::Collector<E, std::vector<std::vector<E>>, std::vector<std::vector<E>>> collectorValue = collector::usePartition<E>(size);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     template <typename KeyExtractor>
     auto partitionBy(KeyExtractor &&keyExtractor) const -> std::vector<std::vector<E>>
     {
         collector::Collector<E, std::map<function::Timestamp, std::vector<E>>, std::vector<std::vector<E>>> collectorValue = collector::usePartitionBy<E, KeyExtractor>(std::forward<KeyExtractor>(keyExtractor));
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     template <typename KeyExtractor, typename ValueExtractor>
@@ -282,40 +481,40 @@ class Collectable
     {
         using V = decltype(std::declval<ValueExtractor>()(std::declval<E>()));
         collector::Collector<E, std::map<function::Timestamp, std::vector<V>>, std::vector<std::vector<V>>> collectorValue = collector::usePartitionBy<E, V, KeyExtractor, ValueExtractor>(std::forward<KeyExtractor>(keyExtractor), std::forward<ValueExtractor>(valueExtractor));
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     template <typename D>
     auto range() const -> D
     {
         collector::Collector<E, std::pair<D, D>, D> collectorValue = collector::useRange<E, D>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->unordered());
     }
 
     template <typename D>
     auto range(const function::Function<E, D> &mapper) const -> D
     {
         collector::Collector<E, std::pair<D, D>, D> collectorValue = collector::useRange<E, D>(mapper);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->unordered());
     }
 
     auto reduce(const function::BiFunction<E, E, E> &accumulator) const -> std::optional<E>
     {
         collector::Collector<E, std::optional<E>, std::optional<E>> collectorValue = collector::useReduce<E>(accumulator);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto reduce(const E &identity, const function::BiFunction<E, E, E> &accumulator) const -> E
     {
         collector::Collector<E, E, E> collectorValue = collector::useReduce<E>(identity, accumulator);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     template <typename R>
     auto reduce(const R &identity, const function::BiFunction<R, E, R> &accumulator, const function::BiFunction<R, R, R> &combiner) const -> R
     {
         collector::Collector<E, R, R> collectorValue = collector::useReduce<E, R>(identity, accumulator, combiner);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto semantic() const -> semantic::Semantic<E>;
@@ -326,39 +525,39 @@ class Collectable
     auto summate() const -> D
     {
         collector::Collector<E, D, D> collectorValue = collector::useSummate<E, D>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->unordered());
     }
 
     template <typename D>
     auto summate(const function::Function<E, D> &mapper) const -> D
     {
         collector::Collector<E, D, D> collectorValue = collector::useSummate<E, D>(mapper);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->unordered());
     }
 
     template <std::size_t N>
     auto toArray() const -> std::array<E, N>
     {
         collector::Collector<E, std::array<E, N>, std::array<E, N>> collectorValue = collector::useToArray<E, N>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto toDeque() const -> std::deque<E>
     {
         collector::Collector<E, std::deque<E>, std::deque<E>> collectorValue = collector::useToDeque<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto toForwardList() const -> std::forward_list<E>
     {
         collector::Collector<E, std::forward_list<E>, std::forward_list<E>> collectorValue = collector::useToForwardList<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto toList() const -> std::list<E>
     {
         collector::Collector<E, std::list<E>, std::list<E>> collectorValue = collector::useToList<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     template <typename KeyExtractor>
@@ -366,7 +565,7 @@ class Collectable
     {
         using K = decltype(std::declval<KeyExtractor>()(std::declval<E>()));
         collector::Collector<E, std::map<K, E>, std::map<K, E>> collectorValue = collector::useToMap<E, K, KeyExtractor>(std::forward<KeyExtractor>(keyExtractor));
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     template <typename KeyExtractor, typename ValueExtractor>
@@ -375,7 +574,7 @@ class Collectable
         using K = decltype(std::declval<KeyExtractor>()(std::declval<E>()));
         using V = decltype(std::declval<ValueExtractor>()(std::declval<E>()));
         collector::Collector<E, std::map<K, V>, std::map<K, V>> collectorValue = collector::useToMap<E, K, V, KeyExtractor, ValueExtractor>(std::forward<KeyExtractor>(keyExtractor), std::forward<ValueExtractor>(valueExtractor));
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     template <typename KeyExtractor>
@@ -383,7 +582,7 @@ class Collectable
     {
         using K = decltype(std::declval<KeyExtractor>()(std::declval<E>()));
         collector::Collector<E, std::multimap<K, E>, std::multimap<K, E>> collectorValue = collector::useToMultimap<E, K, KeyExtractor>(std::forward<KeyExtractor>(keyExtractor));
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     template <typename KeyExtractor, typename ValueExtractor>
@@ -392,44 +591,44 @@ class Collectable
         using K = decltype(std::declval<KeyExtractor>()(std::declval<E>()));
         using V = decltype(std::declval<ValueExtractor>()(std::declval<E>()));
         collector::Collector<E, std::multimap<K, V>, std::multimap<K, V>> collectorValue = collector::useToMultimap<E, K, V, KeyExtractor, ValueExtractor>(std::forward<KeyExtractor>(keyExtractor), std::forward<ValueExtractor>(valueExtractor));
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto toMultiset() const -> std::multiset<E>
     {
         collector::Collector<E, std::multiset<E>, std::multiset<E>> collectorValue = collector::useToMultiset<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->unordered());
     }
 
     auto toPriorityQueue() const -> std::priority_queue<E>
     {
         collector::Collector<E, std::priority_queue<E>, std::priority_queue<E>> collectorValue = collector::useToPriorityQueue<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto toQueue() const -> std::queue<E>
     {
         collector::Collector<E, std::queue<E>, std::queue<E>> collectorValue = collector::useToQueue<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto toSet() const -> std::set<E>
     {
         collector::Collector<E, std::set<E>, std::set<E>> collectorValue = collector::useToSet<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->unordered());
     }
 
     auto toStack() const -> std::stack<E>
     {
         collector::Collector<E, std::stack<E>, std::stack<E>> collectorValue = collector::useToStack<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     template <typename K, typename V>
     auto toUnorderedMap(const function::BiFunction<E, function::Timestamp, K> &keyExtractor, const function::BiFunction<E, function::Timestamp, V> &valueExtractor) const -> std::unordered_map<K, V>
     {
         collector::Collector<E, std::unordered_map<K, V>, std::unordered_map<K, V>> collectorValue = collector::useToUnorderedMap<E, K, V>(keyExtractor, valueExtractor);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     template <typename KeyExtractor>
@@ -437,7 +636,7 @@ class Collectable
     {
         using K = decltype(std::declval<KeyExtractor>()(std::declval<E>()));
         collector::Collector<E, std::unordered_multimap<K, E>, std::unordered_multimap<K, E>> collectorValue = collector::useToUnorderedMultimap<E, K, KeyExtractor>(std::forward<KeyExtractor>(keyExtractor));
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     template <typename KeyExtractor, typename ValueExtractor>
@@ -446,25 +645,25 @@ class Collectable
         using K = decltype(std::declval<KeyExtractor>()(std::declval<E>()));
         using V = decltype(std::declval<ValueExtractor>()(std::declval<E>()));
         collector::Collector<E, std::unordered_multimap<K, V>, std::unordered_multimap<K, V>> collectorValue = collector::useToUnorderedMultimap<E, K, V, KeyExtractor, ValueExtractor>(std::forward<KeyExtractor>(keyExtractor), std::forward<ValueExtractor>(valueExtractor));
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto toUnorderedMultiset() const -> std::unordered_multiset<E>
     {
         collector::Collector<E, std::unordered_multiset<E>, std::unordered_multiset<E>> collectorValue = collector::useToUnorderedMultiset<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->unordered());
     }
 
     auto toUnorderedSet() const -> std::unordered_set<E>
     {
         collector::Collector<E, std::unordered_set<E>, std::unordered_set<E>> collectorValue = collector::useToUnorderedSet<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->unordered());
     }
 
     auto toVector() const -> std::vector<E>
     {
         collector::Collector<E, std::vector<E>, std::vector<E>> collectorValue = collector::useToVector<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 };
 
@@ -472,7 +671,74 @@ template <typename E>
 class OrderedCollectable : public Collectable<E>
 {
   protected:
+    struct Pending
+    {
+        std::vector<std::pair<function::Timestamp, E>> values;
+        function::Comparator<std::pair<function::Timestamp, E>> comparator;
+        bool presorted = false;
+        std::once_flag once;
+        std::multimap<function::Timestamp, E> buffer;
+    };
+
+    struct Contiguous
+    {
+        std::once_flag once;
+        std::vector<E> values;
+    };
+
     std::multimap<function::Timestamp, E> buffer;
+    std::shared_ptr<Pending> pending;
+    std::shared_ptr<Contiguous> flat = std::make_shared<Contiguous>();
+
+    template <typename>
+    friend class semantic::Semantic;
+
+    auto ordered() const -> const std::multimap<function::Timestamp, E> &
+    {
+        if (this->pending == nullptr)
+        {
+            return this->buffer;
+        }
+        std::call_once(this->pending->once, [this]() -> void {
+            std::vector<std::pair<function::Timestamp, E>> values = this->pending->values;
+            if (!this->pending->presorted)
+            {
+                this->arrange(values, this->pending->comparator);
+            }
+            function::Module position = 0ULL;
+            for (const auto &pair : values)
+            {
+                this->pending->buffer.insert(std::make_pair(position, pair.second));
+                position = position + 1ULL;
+            }
+        });
+        return this->pending->buffer;
+    }
+
+    virtual auto extent() const -> std::optional<function::Module> override
+    {
+        return this->pending == nullptr ? this->buffer.size() : this->pending->values.size();
+    }
+
+    virtual auto unordered() const -> function::Generator<E> override
+    {
+        if (this->pending == nullptr)
+        {
+            return this->source();
+        }
+        return [pending = this->pending](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
+            function::Timestamp index = 0;
+            for (const auto &pair : pending->values)
+            {
+                if (interrupt(pair.second, index))
+                {
+                    break;
+                }
+                accept(pair.second, index);
+                ++index;
+            }
+        };
+    }
 
     function::Comparator<std::pair<function::Timestamp, E>> build(const function::Comparator<E> &comparator) const
     {
@@ -503,11 +769,54 @@ class OrderedCollectable : public Collectable<E>
         return index % period;
     }
 
+    void arrange(std::vector<std::pair<function::Timestamp, E>> &values, const function::Comparator<std::pair<function::Timestamp, E>> &comparator) const
+    {
+        std::size_t size = values.size();
+        std::size_t parts = std::min<std::size_t>(this->concurrent, size / 1024 + 1);
+        if (parts < 2)
+        {
+            std::sort(values.begin(), values.end(), comparator);
+            return;
+        }
+        pool::Executor &pool = collector::currentExecutor(this->executor);
+        std::size_t chunk = (size + parts - 1) / parts;
+        pool.parallelFor(0, size, [&values, &comparator](std::size_t from, std::size_t to) {
+            std::sort(values.begin() + from, values.begin() + to, comparator);
+        },
+                         chunk);
+        for (std::size_t width = chunk; width < size; width *= 2)
+        {
+            pool.parallelFor(0, size, [&values, &comparator, width](std::size_t from, std::size_t to) {
+                std::size_t middle = std::min(from + width, to);
+                std::inplace_merge(values.begin() + from, values.begin() + middle, values.begin() + to, comparator);
+            },
+                             width * 2);
+        }
+    }
+
+    auto contiguous() const -> const std::vector<E> &
+    {
+        std::call_once(this->flat->once, [this]() -> void {
+            const std::multimap<function::Timestamp, E> &ordered = this->ordered();
+            this->flat->values.reserve(ordered.size());
+            for (const auto &pair : ordered)
+            {
+                this->flat->values.push_back(pair.second);
+            }
+        });
+        return this->flat->values;
+    }
+
   public:
     OrderedCollectable(const function::Generator<E> &generator) : Collectable<E>(1)
     {
         std::vector<std::pair<function::Timestamp, E>> tempBuffer;
-        generator([&tempBuffer](E element, function::Timestamp index) -> void { tempBuffer.emplace_back(index, element); }, [](E element, function::Timestamp index) -> bool { return false; });
+        const pool::CancellationToken *token = pool::CancellationToken::current();
+        generator([&tempBuffer](E element, function::Timestamp index) -> void { tempBuffer.emplace_back(index, element); }, [token](E element, function::Timestamp index) -> bool { return token != nullptr && token->cancelled(); });
+        if (token != nullptr)
+        {
+            token->check();
+        }
         function::Module period = static_cast<function::Module>(tempBuffer.size());
         for (const auto &pair : tempBuffer)
         {
@@ -516,10 +825,15 @@ class OrderedCollectable : public Collectable<E>
         }
     }
 
-    OrderedCollectable(const function::Generator<E> &generator, const function::Module &concurrent) : Collectable<E>(concurrent)
+    OrderedCollectable(const function::Generator<E> &generator, const function::Module &concurrent, pool::Executor *executor = nullptr) : Collectable<E>(concurrent, executor)
     {
         std::vector<std::pair<function::Timestamp, E>> tempBuffer;
-        generator([&tempBuffer](E element, function::Timestamp index) -> void { tempBuffer.emplace_back(index, element); }, [](E element, function::Timestamp index) -> bool { return false; });
+        const pool::CancellationToken *token = pool::CancellationToken::current();
+        generator([&tempBuffer](E element, function::Timestamp index) -> void { tempBuffer.emplace_back(index, element); }, [token](E element, function::Timestamp index) -> bool { return token != nullptr && token->cancelled(); });
+        if (token != nullptr)
+        {
+            token->check();
+        }
         function::Module period = static_cast<function::Module>(tempBuffer.size());
         for (const auto &pair : tempBuffer)
         {
@@ -530,35 +844,37 @@ class OrderedCollectable : public Collectable<E>
 
     OrderedCollectable(const function::Generator<E> &generator, const function::Comparator<E> &comparator) : Collectable<E>(1)
     {
-        auto comp = build(comparator);
-        std::multiset<std::pair<function::Timestamp, E>, decltype(comp)> tempBuffer(comp);
-        generator([&tempBuffer](E element, function::Timestamp index) -> void { tempBuffer.insert(std::make_pair(index, element)); }, [](E element, function::Timestamp index) -> bool { return false; });
-        function::Module position = 0ULL;
-        for (const auto &pair : tempBuffer)
+        std::vector<std::pair<function::Timestamp, E>> tempBuffer;
+        const pool::CancellationToken *token = pool::CancellationToken::current();
+        generator([&tempBuffer](E element, function::Timestamp index) -> void { tempBuffer.emplace_back(index, element); }, [token](E element, function::Timestamp index) -> bool { return token != nullptr && token->cancelled(); });
+        if (token != nullptr)
         {
-            this->buffer.insert(std::make_pair(position, pair.second));
-            position = position + 1ULL;
+            token->check();
         }
+        this->pending = std::make_shared<Pending>();
+        this->pending->values = std::move(tempBuffer);
+        this->pending->comparator = build(comparator);
     }
 
-    OrderedCollectable(const function::Generator<E> &generator, const function::Comparator<E> &comparator, const function::Module &concurrent) : Collectable<E>(concurrent)
+    OrderedCollectable(const function::Generator<E> &generator, const function::Comparator<E> &comparator, const function::Module &concurrent, pool::Executor *executor = nullptr) : Collectable<E>(concurrent, executor)
     {
-        auto comp = build(comparator);
-        std::multiset<std::pair<function::Timestamp, E>, decltype(comp)> tempBuffer(comp);
-        generator([&tempBuffer](E element, function::Timestamp index) -> void { tempBuffer.insert(std::make_pair(index, element)); }, [](E element, function::Timestamp index) -> bool { return false; });
-        function::Module position = 0ULL;
-        for (const auto &pair : tempBuffer)
+        std::vector<std::pair<function::Timestamp, E>> tempBuffer;
+        const pool::CancellationToken *token = pool::CancellationToken::current();
+        generator([&tempBuffer](E element, function::Timestamp index) -> void { tempBuffer.emplace_back(index, element); }, [token](E element, function::Timestamp index) -> bool { return token != nullptr && token->cancelled(); });
+        if (token != nullptr)
         {
-            this->buffer.insert(std::make_pair(position, pair.second));
-            position = position + 1ULL;
+            token->check();
         }
+        this->pending = std::make_shared<Pending>();
+        this->pending->values = std::move(tempBuffer);
+        this->pending->comparator = build(comparator);
     }
 
-    OrderedCollectable(const OrderedCollectable<E> &other) : Collectable<E>(other.concurrent), buffer(other.buffer)
+    OrderedCollectable(const OrderedCollectable<E> &other) : Collectable<E>(other), buffer(other.buffer), pending(other.pending), flat(other.flat)
     {
     }
 
-    OrderedCollectable(OrderedCollectable<E> &&other) noexcept : Collectable<E>(other.concurrent), buffer(std::move(other.buffer))
+    OrderedCollectable(OrderedCollectable<E> &&other) noexcept : Collectable<E>(std::move(other)), buffer(std::move(other.buffer)), pending(std::move(other.pending)), flat(std::move(other.flat))
     {
     }
 
@@ -567,7 +883,12 @@ class OrderedCollectable : public Collectable<E>
         if (this != &other)
         {
             this->concurrent = other.concurrent;
+            this->executor = other.executor;
+            this->profiler = other.profiler;
+            this->plan = other.plan;
             this->buffer = other.buffer;
+            this->pending = other.pending;
+            this->flat = other.flat;
         }
         return *this;
     }
@@ -577,14 +898,42 @@ class OrderedCollectable : public Collectable<E>
         if (this != &other)
         {
             this->concurrent = other.concurrent;
+            this->executor = other.executor;
+            this->profiler = other.profiler;
+            this->plan = other.plan;
             this->buffer = std::move(other.buffer);
+            this->pending = std::move(other.pending);
+            this->flat = std::move(other.flat);
         }
         return *this;
     }
 
+    auto semantic() const -> semantic::Semantic<E>;
+
+    virtual auto findAt(const function::Timestamp &index) const -> std::optional<E> override
+    {
+        if (this->profiler != nullptr)
+        {
+            return Collectable<E>::findAt(index);
+        }
+        const std::multimap<function::Timestamp, E> &ordered = this->ordered();
+        if (ordered.empty())
+        {
+            return std::nullopt;
+        }
+        if (index >= 0LL)
+        {
+            auto found = ordered.lower_bound(index);
+            return found == ordered.end() || found->first != index ? std::nullopt : std::optional<E>(found->second);
+        }
+        function::Module size = ordered.size();
+        function::Module target = (size - static_cast<function::Module>(std::abs(index)) % size) % size;
+        return std::optional<E>(std::prev(ordered.end(), static_cast<std::ptrdiff_t>(size - target))->second);
+    }
+
     virtual auto source() const -> function::Generator<E> override
     {
-        return [buffer = this->buffer](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
+        return [buffer = this->ordered()](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
             for (const auto &pair : buffer)
             {
                 if (interrupt(pair.second, pair.first))
@@ -607,7 +956,7 @@ class Statistics : public OrderedCollectable<E>
 
     Statistics(const function::Generator<E> &generator) : OrderedCollectable<E>(generator) {}
 
-    Statistics(const function::Generator<E> &generator, const function::Module &concurrent) : OrderedCollectable<E>(generator, concurrent) {}
+    Statistics(const function::Generator<E> &generator, const function::Module &concurrent, pool::Executor *executor = nullptr) : OrderedCollectable<E>(generator, concurrent, executor) {}
 
     Statistics(const Statistics<E, D> &other) : OrderedCollectable<E>(other) {}
 
@@ -634,145 +983,149 @@ class Statistics : public OrderedCollectable<E>
     auto summate() const -> D
     {
         collector::Collector<E, D, D> collectorValue = collector::useSummate<E, D>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->contiguous());
     }
 
     auto summate(const function::Function<E, D> &mapper) const -> D
     {
         collector::Collector<E, D, D> collectorValue = collector::useSummate<E, D>(mapper);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
+    }
+
+    auto compensatedSummate() const -> D
+    {
+        collector::Collector<E, std::pair<D, D>, D> collectorValue = collector::useCompensatedSummate<E, D>();
+        return this->perform(__func__, collectorValue, this->contiguous());
     }
 
     auto average() const -> D
     {
         collector::Collector<E, std::pair<D, function::Module>, D> collectorValue = collector::useAverage<E, D>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->contiguous());
     }
 
     auto average(const function::Function<E, D> &mapper) const -> D
     {
         collector::Collector<E, std::pair<D, function::Module>, D> collectorValue = collector::useAverage<E, D>(mapper);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto minimum() const -> std::optional<D>
     {
         collector::Collector<E, std::optional<D>, std::optional<D>> collectorValue = collector::useMinimum<E, D>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->contiguous());
     }
 
     auto minimum(const function::Function<E, D> &mapper) const -> std::optional<D>
     {
         collector::Collector<E, std::optional<D>, std::optional<D>> collectorValue = collector::useMinimum<E, D>(mapper);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto maximum() const -> std::optional<D>
     {
         collector::Collector<E, std::optional<D>, std::optional<D>> collectorValue = collector::useMaximum<E, D>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->contiguous());
     }
 
     auto maximum(const function::Function<E, D> &mapper) const -> std::optional<D>
     {
         collector::Collector<E, std::optional<D>, std::optional<D>> collectorValue = collector::useMaximum<E, D>(mapper);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto range() const -> D
     {
         collector::Collector<E, std::pair<D, D>, D> collectorValue = collector::useRange<E, D>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->contiguous());
     }
 
     auto range(const function::Function<E, D> &mapper) const -> D
     {
         collector::Collector<E, std::pair<D, D>, D> collectorValue = collector::useRange<E, D>(mapper);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto variance() const -> D
     {
-        collector::Collector<E, std::tuple<D, D, D, function::Module>, D> collectorValue = collector::useVariance<E, D>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        collector::Collector<E, collector::Moments<D>, D> collectorValue = collector::useVariance<E, D>();
+        return this->perform(__func__, collectorValue, this->contiguous());
     }
 
     auto variance(const function::Function<E, D> &mapper) const -> D
     {
-        collector::Collector<E, std::tuple<D, D, D, function::Module>, D> collectorValue = collector::useVariance<E, D>(mapper);
-        return collectorValue.collect(this->source(), this->concurrent);
+        collector::Collector<E, collector::Moments<D>, D> collectorValue = collector::useVariance<E, D>(mapper);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto standardDeviation() const -> D
     {
-        collector::Collector<E, std::tuple<D, D, D, function::Module>, D> collectorValue = collector::useStandardDeviation<E, D>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        collector::Collector<E, collector::Moments<D>, D> collectorValue = collector::useStandardDeviation<E, D>();
+        return this->perform(__func__, collectorValue, this->contiguous());
     }
 
     auto standardDeviation(const function::Function<E, D> &mapper) const -> D
     {
-        collector::Collector<E, std::tuple<D, D, D, function::Module>, D> collectorValue = collector::useStandardDeviation<E, D>(mapper);
-        return collectorValue.collect(this->source(), this->concurrent);
+        collector::Collector<E, collector::Moments<D>, D> collectorValue = collector::useStandardDeviation<E, D>(mapper);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto frequency() const -> std::map<E, std::pair<std::vector<std::complex<double>>, std::vector<std::complex<double>>>>
     {
-        using InnerMap = std::unordered_map<E, std::pair<std::vector<std::complex<double>>, std::vector<std::complex<double>>>>;
-        using AccumulatorType = std::pair<InnerMap, function::Timestamp>;
+        using AccumulatorType = std::pair<collector::Table<E, std::vector<function::Timestamp>>, function::Timestamp>;
         using ResultMap = std::map<E, std::pair<std::vector<std::complex<double>>, std::vector<std::complex<double>>>>;
-        collector::Collector<E, AccumulatorType, ResultMap> collectorValue = collector::useFrequency<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        collector::Collector<E, AccumulatorType, ResultMap> collectorValue = collector::useCompactFrequency<E>();
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto frequency(const function::Function<E, D> &mapper) const -> std::map<D, std::pair<std::vector<std::complex<double>>, std::vector<std::complex<double>>>>
     {
-        using InnerMap = std::unordered_map<D, std::pair<std::vector<std::complex<double>>, std::vector<std::complex<double>>>>;
-        using AccumulatorType = std::pair<InnerMap, function::Timestamp>;
+        using AccumulatorType = std::pair<collector::Table<D, std::vector<function::Timestamp>>, function::Timestamp>;
         using ResultMap = std::map<D, std::pair<std::vector<std::complex<double>>, std::vector<std::complex<double>>>>;
-        collector::Collector<E, AccumulatorType, ResultMap> collectorValue = collector::useFrequency<E, D>(mapper);
-        return collectorValue.collect(this->source(), this->concurrent);
+        collector::Collector<E, AccumulatorType, ResultMap> collectorValue = collector::useCompactFrequency<E, D>(mapper);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto distribute() const -> std::map<E, std::complex<double>>
     {
-        collector::Collector<E, std::unordered_map<E, std::vector<function::Timestamp>>, std::map<E, std::complex<double>>> collectorValue = collector::useDistribution<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        collector::Collector<E, collector::Table<E, collector::Tally>, std::map<E, std::complex<double>>> collectorValue = collector::useCompactDistribution<E>();
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto distribute(const function::Function<E, D> &mapper) const -> std::map<D, std::complex<double>>
     {
-        collector::Collector<E, std::unordered_map<D, std::vector<function::Timestamp>>, std::map<D, std::complex<double>>> collectorValue = collector::useDistribution<E, D>(mapper);
-        return collectorValue.collect(this->source(), this->concurrent);
+        collector::Collector<E, collector::Table<D, collector::Tally>, std::map<D, std::complex<double>>> collectorValue = collector::useCompactDistribution<E, D>(mapper);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto median() const -> std::optional<D>
     {
         collector::Collector<E, std::vector<D>, std::optional<D>> collectorValue = collector::useMedian<E, D>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto median(const function::Function<E, D> &mapper) const -> std::optional<D>
     {
         collector::Collector<E, std::vector<D>, std::optional<D>> collectorValue = collector::useMedian<E, D>(mapper);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto mode() const -> std::optional<E>
     {
-        collector::Collector<E, std::unordered_map<E, std::complex<double>>, std::optional<E>> collectorValue = collector::useMode<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        collector::Collector<E, collector::Table<E, collector::Tally>, std::optional<E>> collectorValue = collector::useCompactMode<E>();
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto percentile(double p) const -> std::optional<D>
     {
         collector::Collector<E, std::vector<D>, std::optional<D>> collectorValue = collector::usePercentile<E, D>(p);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto percentile(double p, const function::Function<E, D> &mapper) const -> std::optional<D>
     {
         collector::Collector<E, std::vector<D>, std::optional<D>> collectorValue = collector::usePercentile<E, D>(p, mapper);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto firstQuartile() const -> std::optional<D>
@@ -813,52 +1166,76 @@ class Statistics : public OrderedCollectable<E>
         return std::nullopt;
     }
 
+    auto histogram(const std::size_t &bins, const double &lower, const double &upper) const -> collector::Histogram
+    {
+        collector::Collector<E, collector::Histogram, collector::Histogram> collectorValue = collector::useHistogram<E>(bins, lower, upper);
+        return this->perform(__func__, collectorValue, this->source());
+    }
+
+    auto histogram(const std::size_t &bins, const double &lower, const double &upper, const function::Function<E, D> &mapper) const -> collector::Histogram
+    {
+        collector::Collector<E, collector::Histogram, collector::Histogram> collectorValue = collector::useHistogram<E, D>(bins, lower, upper, mapper);
+        return this->perform(__func__, collectorValue, this->source());
+    }
+
+    auto logHistogram(const double &precision) const -> collector::Histogram
+    {
+        collector::Collector<E, collector::Histogram, collector::Histogram> collectorValue = collector::useLogHistogram<E>(precision);
+        return this->perform(__func__, collectorValue, this->source());
+    }
+
+    auto logHistogram(const double &precision, const function::Function<E, D> &mapper) const -> collector::Histogram
+    {
+        collector::Collector<E, collector::Histogram, collector::Histogram> collectorValue = collector::useLogHistogram<E, D>(precision, mapper);
+        return this->perform(__func__, collectorValue, this->source());
+    }
+
     auto skewness() const -> D
     {
         collector::Collector<E, std::vector<D>, D> collectorValue = collector::useSkewness<E, D>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto skewness(const function::Function<E, D> &mapper) const -> D
     {
         collector::Collector<E, std::vector<D>, D> collectorValue = collector::useSkewness<E, D>(mapper);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto kurtosis() const -> D
     {
         collector::Collector<E, std::vector<D>, D> collectorValue = collector::useKurtosis<E, D>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto kurtosis(const function::Function<E, D> &mapper) const -> D
     {
         collector::Collector<E, std::vector<D>, D> collectorValue = collector::useKurtosis<E, D>(mapper);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto dft() const -> std::vector<std::complex<double>>
     {
         collector::Collector<E, std::vector<std::complex<double>>, std::vector<std::complex<double>>> collectorValue = collector::useDFT<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto idft() const -> std::vector<std::complex<double>>
     {
         collector::Collector<E, std::vector<std::complex<double>>, std::vector<std::complex<double>>> collectorValue = collector::useIDFT<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto fft() const -> std::vector<std::complex<double>>
     {
         collector::Collector<E, std::vector<std::complex<double>>, std::vector<std::complex<double>>> collectorValue = collector::useFFT<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto ifft() const -> std::vector<std::complex<double>>
     {
         collector::Collector<E, std::vector<std::complex<double>>, std::vector<std::complex<double>>> collectorValue = collector::useIFFT<E>();
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto gradient(const std::function<std::vector<double>(const std::vector<E> &)> &gradientFunction,
@@ -866,7 +1243,7 @@ class Statistics : public OrderedCollectable<E>
     {
         collector::Collector<E, std::vector<double>, std::vector<double>> collectorValue =
             collector::useGradient<E>(gradientFunction, learningRate, maxIterations, convergenceThreshold);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 
     auto gradient(const std::function<double(const std::vector<E> &)> &costFunction,
@@ -874,16 +1251,19 @@ class Statistics : public OrderedCollectable<E>
     {
         collector::Collector<E, std::vector<double>, std::vector<double>> collectorValue =
             collector::useGradient<E>(costFunction, learningRate, maxIterations, convergenceThreshold, numericalH);
-        return collectorValue.collect(this->source(), this->concurrent);
+        return this->perform(__func__, collectorValue, this->source());
     }
 };
 
 template <typename E>
 class WindowCollectable : public OrderedCollectable<E>
 {
+  private:
+    auto extremum(const function::Module &size, const function::Timestamp &step, const function::Comparator<E> &comparator) const -> semantic::Semantic<E>;
+
   public:
     WindowCollectable(const function::Module &concurrent) : OrderedCollectable<E>(concurrent) {}
-    WindowCollectable(const function::Generator<E> &generator, const function::Module &concurrent) : OrderedCollectable<E>(generator, concurrent) {}
+    WindowCollectable(const function::Generator<E> &generator, const function::Module &concurrent, pool::Executor *executor = nullptr) : OrderedCollectable<E>(generator, concurrent, executor) {}
     WindowCollectable(const WindowCollectable<E> &other) : OrderedCollectable<E>(other) {}
     WindowCollectable(WindowCollectable<E> &&other) noexcept : OrderedCollectable<E>(std::move(other)) {}
 
@@ -911,6 +1291,33 @@ class WindowCollectable : public OrderedCollectable<E>
     {
         return this->slide(size, size);
     }
+
+    template <typename A, typename R>
+    auto slideAggregate(const function::Module &size, const function::Timestamp &step, const function::Supplier<A> &identity, const function::BiFunction<A, E, A> &accumulator, const function::BiFunction<A, E, A> &retractor, const function::Function<A, R> &finisher) const -> semantic::Semantic<R>;
+
+    template <typename A>
+    auto slideReduce(const function::Module &size, const function::Timestamp &step, const function::Function<E, A> &mapper, const function::BiFunction<A, A, A> &combiner) const -> semantic::Semantic<A>;
+
+    auto slideCount(const function::Module &size, const function::Timestamp &step) const -> semantic::Semantic<function::Module>;
+
+    template <typename D>
+    auto slideSummate(const function::Module &size, const function::Timestamp &step) const -> semantic::Semantic<D>;
+
+    template <typename D>
+    auto slideAverage(const function::Module &size, const function::Timestamp &step) const -> semantic::Semantic<D>;
+
+    template <typename D>
+    auto slideVariance(const function::Module &size, const function::Timestamp &step) const -> semantic::Semantic<D>;
+
+    auto slideMinimum(const function::Module &size, const function::Timestamp &step) const -> semantic::Semantic<E>
+    {
+        return this->extremum(size, step, [](const E &a, const E &b) -> bool { return a < b; });
+    }
+
+    auto slideMaximum(const function::Module &size, const function::Timestamp &step) const -> semantic::Semantic<E>
+    {
+        return this->extremum(size, step, [](const E &a, const E &b) -> bool { return b < a; });
+    }
 };
 
 template <typename E>
@@ -919,22 +1326,37 @@ class UnorderedCollectable : public Collectable<E>
   protected:
     std::unordered_multimap<function::Timestamp, E> buffer;
 
+    virtual auto extent() const -> std::optional<function::Module> override
+    {
+        return this->buffer.size();
+    }
+
   public:
     UnorderedCollectable(const function::Generator<E> &generator) : Collectable<E>(1)
     {
-        generator([this](E element, function::Timestamp index) -> void { this->buffer.insert(std::make_pair(index, element)); }, [](E element, function::Timestamp index) -> bool { return false; });
+        const pool::CancellationToken *token = pool::CancellationToken::current();
+        generator([this](E element, function::Timestamp index) -> void { this->buffer.insert(std::make_pair(index, element)); }, [token](E element, function::Timestamp index) -> bool { return token != nullptr && token->cancelled(); });
+        if (token != nullptr)
+        {
+            token->check();
+        }
     }
 
-    UnorderedCollectable(const function::Generator<E> &generator, const function::Module &concurrent) : Collectable<E>(concurrent)
+    UnorderedCollectable(const function::Generator<E> &generator, const function::Module &concurrent, pool::Executor *executor = nullptr) : Collectable<E>(concurrent, executor)
     {
-        generator([this](E element, function::Timestamp index) -> void { this->buffer.insert(std::make_pair(index, element)); }, [](E element, function::Timestamp index) -> bool { return false; });
+        const pool::CancellationToken *token = pool::CancellationToken::current();
+        generator([this](E element, function::Timestamp index) -> void { this->buffer.insert(std::make_pair(index, element)); }, [token](E element, function::Timestamp index) -> bool { return token != nullptr && token->cancelled(); });
+        if (token != nullptr)
+        {
+            token->check();
+        }
     }
 
-    UnorderedCollectable(const UnorderedCollectable &other) : Collectable<E>(other.concurrent), buffer(other.buffer)
+    UnorderedCollectable(const UnorderedCollectable &other) : Collectable<E>(other), buffer(other.buffer)
     {
     }
 
-    UnorderedCollectable(UnorderedCollectable &&other) noexcept : Collectable<E>(other.concurrent), buffer(std::move(other.buffer))
+    UnorderedCollectable(UnorderedCollectable &&other) noexcept : Collectable<E>(std::move(other)), buffer(std::move(other.buffer))
     {
     }
 
@@ -983,75 +1405,552 @@ class Semantic
   protected:
     std::unique_ptr<function::Generator<E>> generator;
     function::Module concurrent;
+    pool::Executor *executor = nullptr;
+    std::shared_ptr<collector::Profile> profiler;
+    const collector::Profile::Row *row = nullptr;
+    std::shared_ptr<const Plan> plan;
+    Characteristics traits;
 
-  public:
-    using Element = E;
+    struct Fusion
+    {
+        function::Generator<E> base;
+        std::vector<function::BiPredicate<E, function::Timestamp>> predicates;
+        function::Module start = 0;
+        function::Module end = std::numeric_limits<function::Module>::max();
+        function::Module shift = 0;
+        std::shared_ptr<const std::vector<std::pair<function::Timestamp, E>>> sorted;
+        function::Comparator<std::pair<function::Timestamp, E>> comparator;
+        function::Function<function::Module, E> at;
+        function::Module extent = 0;
+    };
 
-    Semantic(Semantic<E> &&other) noexcept = default;
+    std::shared_ptr<const Fusion> fusion;
 
-    Semantic(const function::Generator<E> &generator) : generator(std::make_unique<function::Generator<E>>(generator)), concurrent(1) {}
+    template <typename>
+    friend class Semantic;
 
-    Semantic(const function::Generator<E> &generator, const function::Module &concurrent) : generator(std::make_unique<function::Generator<E>>(generator)), concurrent(concurrent) {}
+    template <typename>
+    friend class collectable::Collectable;
 
-    Semantic(const Semantic<E> &other) : generator(std::make_unique<function::Generator<E>>(*other.generator)), concurrent(other.concurrent) {}
+    template <typename>
+    friend class collectable::OrderedCollectable;
 
-    Semantic<E> &operator=(const Semantic<E> &other)
+    template <typename R>
+    auto inherit(Semantic<R> &&next) const -> Semantic<R>
     {
-        if (this != &other)
+        next.profiler = this->profiler;
+        next.row = this->row;
+        next.plan = this->plan;
+        next.traits = this->traits;
+        return std::move(next);
+    }
+
+    template <typename R>
+    auto stage(const std::string &name, Semantic<R> &&next, const Characteristics &characteristics = Characteristics()) const -> Semantic<R>
+    {
+        next.plan = std::make_shared<const Plan>(Plan{name, std::string(), this->plan});
+        next.traits = characteristics;
+        if (this->profiler == nullptr)
         {
-            generator = std::make_unique<function::Generator<E>>(*other.generator);
-            concurrent = other.concurrent;
+            return std::move(next);
         }
-        return *this;
+        collector::Profile::Row &record = this->profiler->stage(name, this->row);
+        *next.generator = collector::Profile::instrument(this->profiler, record, std::move(*next.generator));
+        next.profiler = this->profiler;
+        next.row = &record;
+        return std::move(next);
     }
 
-    Semantic<E> &operator=(Semantic<E> &&other) noexcept = default;
-
-    virtual ~Semantic() = default;
-
-    template <typename Container>
-    auto concatenate(Container &&container) const -> Semantic<E>
+    template <typename Result, typename Build>
+    auto materialize(const char *name, Build &&build) const -> Result
     {
-        if constexpr (std::is_same_v<std::decay_t<Container>, Semantic<E>>)
+        if (this->profiler == nullptr)
         {
-            return Semantic<E>(
-                [generator = *(this->generator), other = std::forward<Container>(container)](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
-                    function::Timestamp count = 0LL;
-                    bool stop = false;
-                    generator(
-                        [&accept, &count](E element, function::Timestamp index) -> void {
-                            accept(element, count);
-                            count++;
-                        },
-                        [&stop](E element, function::Timestamp index) -> bool {
-                            return stop;
-                        });
-                    other.source()(
-                        [&accept, &count](E element, function::Timestamp index) -> void {
-                            accept(element, count);
-                            count++;
-                        },
-                        [&interrupt, &stop, &count](E element, function::Timestamp index) -> bool {
-                            if (interrupt(element, count))
-                            {
-                                stop = true;
-                                return true;
-                            }
-                            return false;
-                        });
-                },
-                this->concurrent);
+            Result result = build();
+            result.plan = this->annotate(name, result);
+            return result;
         }
-        else if constexpr (std::is_same_v<std::decay_t<Container>, E>)
+        collector::Profile::Row &record = this->profiler->stage(name, this->row);
+        Result result = collector::Profile::measure(record, std::forward<Build>(build));
+        if (this->row != nullptr)
         {
-            return Semantic<E>(
-                [generator = *(this->generator), element = std::forward<Container>(container)](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
-                    function::Timestamp count = 0LL;
-                    generator(
-                        [&accept, &count](E current, function::Timestamp index) -> void {
-                            accept(current, count);
-                            count++;
-                        },
+            record.elements.store(this->row->elements.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+        result.profiler = this->profiler;
+        result.plan = this->annotate(name, result);
+        return result;
+    }
+
+    template <typename Result>
+    auto annotate(const char *name, const Result &result) const -> std::shared_ptr<const Plan>
+    {
+        std::string note;
+        if constexpr (std::is_base_of_v<collectable::OrderedCollectable<E>, Result>)
+        {
+            if (result.pending != nullptr && result.pending->presorted)
+            {
+                note = "elided: input already sorted";
+            }
+            else if (result.pending != nullptr)
+            {
+                note = "ordering deferred; skipped by order-insensitive terminals";
+            }
+        }
+        return std::make_shared<const Plan>(Plan{name, note, this->plan});
+    }
+
+    template <typename Predicate>
+    static auto erase(const Predicate &predicate) -> function::BiPredicate<E, function::Timestamp>
+    {
+        return [predicate](E element, function::Timestamp index) mutable -> bool {
+            if constexpr (std::is_invocable_v<Predicate &, E, function::Timestamp>)
+            {
+                return std::invoke(predicate, element, index);
+            }
+            else
+            {
+                return std::invoke(predicate, element);
+            }
+        };
+    }
+
+    static auto describe(const Fusion &fusion) -> std::string
+    {
+        std::string text;
+        if (fusion.end == std::numeric_limits<function::Module>::max())
+        {
+            text = "skip(" + std::to_string(fusion.start) + ")";
+        }
+        else if (fusion.start == 0)
+        {
+            text = "limit(" + std::to_string(fusion.end) + ")";
+        }
+        else
+        {
+            text = "sub(" + std::to_string(fusion.start) + ", " + std::to_string(fusion.end) + ")";
+        }
+        return fusion.sorted != nullptr ? "partial sort + " + text : text;
+    }
+
+    static auto fuse(const std::shared_ptr<const Fusion> &fusion) -> function::Generator<E>
+    {
+        if (!fusion->predicates.empty())
+        {
+            return [fusion](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
+                std::vector<function::Timestamp> counts(fusion->predicates.size(), 0);
+                fusion->base(
+                    [&fusion, &counts, &accept](E element, function::Timestamp index) -> void {
+                        for (std::size_t position = 0; position < counts.size(); ++position)
+                        {
+                            if (!fusion->predicates[position](element, index))
+                            {
+                                return;
+                            }
+                            index = counts[position]++;
+                        }
+                        accept(element, index);
+                    },
+                    [&counts, &interrupt](E element, function::Timestamp index) -> bool {
+                        return interrupt(element, counts.back());
+                    });
+            };
+        }
+        if (fusion->sorted != nullptr)
+        {
+            return [fusion](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
+                std::vector<std::pair<function::Timestamp, E>> values = *fusion->sorted;
+                std::size_t end = static_cast<std::size_t>(std::min<function::Module>(fusion->end, values.size()));
+                if (fusion->start >= end)
+                {
+                    return;
+                }
+                std::partial_sort(values.begin(), values.begin() + end, values.end(), fusion->comparator);
+                for (std::size_t position = fusion->start; position < end; ++position)
+                {
+                    function::Timestamp index = static_cast<function::Timestamp>(position - fusion->shift);
+                    if (interrupt(values[position].second, index))
+                    {
+                        break;
+                    }
+                    accept(values[position].second, index);
+                }
+            };
+        }
+        if (fusion->at)
+        {
+            return [fusion](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
+                function::Module end = std::min(fusion->end, fusion->extent);
+                for (function::Module position = fusion->start; position < end; ++position)
+                {
+                    E element = fusion->at(position);
+                    function::Timestamp index = static_cast<function::Timestamp>(position - fusion->shift);
+                    if (interrupt(element, index))
+                    {
+                        break;
+                    }
+                    accept(element, index);
+                }
+            };
+        }
+        return [fusion](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
+            function::Module count = 0;
+            fusion->base(
+                [&fusion, &count, &accept](E element, function::Timestamp index) -> void {
+                    if (count >= fusion->start && count < fusion->end)
+                    {
+                        accept(element, static_cast<function::Timestamp>(count - fusion->shift));
+                    }
+                    count++;
+                },
+                [&fusion, &count, &interrupt](E element, function::Timestamp index) -> bool {
+                    return interrupt(element, static_cast<function::Timestamp>(count) - static_cast<function::Timestamp>(fusion->shift)) || count >= fusion->end;
+                });
+        };
+    }
+
+    auto slice(const std::string &name, const function::Module &start, const function::Module &end) const -> Semantic<E>
+    {
+        constexpr function::Module unbounded = std::numeric_limits<function::Module>::max();
+        Characteristics characteristics = this->traits.keep({Characteristic::sorted, Characteristic::distinct, Characteristic::ordered});
+        if (this->traits.has(Characteristic::sized))
+        {
+            function::Module size = this->traits.size;
+            characteristics = characteristics.sized(std::min(end, size) - std::min(std::min(start, end), size));
+        }
+        std::shared_ptr<Fusion> fusion = std::make_shared<Fusion>();
+        if (this->profiler == nullptr && this->fusion != nullptr && this->fusion->predicates.empty())
+        {
+            const Fusion &previous = *this->fusion;
+            fusion->base = previous.base;
+            fusion->sorted = previous.sorted;
+            fusion->comparator = previous.comparator;
+            fusion->at = previous.at;
+            fusion->extent = previous.extent;
+            fusion->start = previous.start > unbounded - start ? unbounded : previous.start + start;
+            fusion->end = std::min(previous.end, previous.start > unbounded - end ? unbounded : previous.start + end);
+            fusion->shift = previous.start;
+            Semantic<E> next(fuse(fusion), this->concurrent, this->executor);
+            next.fusion = fusion;
+            next.traits = characteristics;
+            if (previous.at && previous.start == 0 && previous.end == unbounded)
+            {
+                next.plan = std::make_shared<const Plan>(Plan{describe(*fusion), "random access", this->plan});
+                return next;
+            }
+            std::string before = this->plan == nullptr ? std::string("sort") : this->plan->step;
+            std::string note = previous.at ? "random access" : this->plan == nullptr || this->plan->note.empty() || previous.sorted != nullptr ? "fused " + before + ", " + name : this->plan->note + ", " + name;
+            next.plan = std::make_shared<const Plan>(Plan{describe(*fusion), note, this->plan == nullptr ? nullptr : this->plan->upstream});
+            return next;
+        }
+        fusion->base = *this->generator;
+        fusion->start = start;
+        fusion->end = end;
+        Semantic<E> next = this->stage(name, Semantic<E>(fuse(fusion), this->concurrent, this->executor), characteristics);
+        if (this->profiler == nullptr)
+        {
+            next.fusion = fusion;
+        }
+        return next;
+    }
+
+    template <typename K>
+    static auto partition(const K &key, const std::size_t &partitions) -> std::size_t
+    {
+        if (partitions < 2)
+        {
+            return 0;
+        }
+        std::uint64_t value = static_cast<std::uint64_t>(std::hash<K>{}(key)) * 0x9e3779b97f4a7c15ULL;
+        return static_cast<std::size_t>(value >> 32) % partitions;
+    }
+
+    template <typename K, typename V, typename R, typename RightKey, typename Store>
+    static auto build(const function::Generator<R> &generator, const RightKey &rightKey, const std::size_t &partitions, pool::Executor *executor, const Store &store) -> std::vector<collector::Table<K, V>>
+    {
+        std::vector<std::pair<K, R>> rows;
+        std::vector<std::size_t> owners;
+        std::vector<std::size_t> sizes(partitions, 0);
+        const pool::CancellationToken *token = pool::CancellationToken::current();
+        generator(
+            [&rightKey, &rows, &owners, &sizes, partitions](R element, function::Timestamp index) -> void {
+                K key = std::invoke(rightKey, element);
+                std::size_t owner = partition(key, partitions);
+                owners.push_back(owner);
+                sizes[owner]++;
+                rows.emplace_back(std::move(key), std::move(element));
+            },
+            [token](R element, function::Timestamp index) -> bool {
+                return token != nullptr && token->cancelled();
+            });
+        if (token != nullptr)
+        {
+            token->check();
+        }
+        std::vector<std::size_t> starts(partitions + 1, 0);
+        for (std::size_t owner = 0; owner < partitions; ++owner)
+        {
+            starts[owner + 1] = starts[owner] + sizes[owner];
+        }
+        std::vector<std::size_t> order(rows.size());
+        std::vector<std::size_t> cursors(starts.begin(), starts.end() - 1);
+        for (std::size_t position = 0; position < rows.size(); ++position)
+        {
+            order[cursors[owners[position]]++] = position;
+        }
+        std::vector<collector::Table<K, V>> tables(partitions);
+        auto fill = [&rows, &order, &starts, &sizes, &tables, &store](std::size_t from, std::size_t to) -> void {
+            for (std::size_t owner = from; owner < to; ++owner)
+            {
+                tables[owner].reserve(sizes[owner]);
+                for (std::size_t slot = starts[owner]; slot < starts[owner + 1]; ++slot)
+                {
+                    std::pair<K, R> &row = rows[order[slot]];
+                    store(*tables[owner].emplace(row.first).first, std::move(row.second));
+                }
+            }
+        };
+        if (partitions < 2)
+        {
+            fill(0, partitions);
+        }
+        else
+        {
+            collector::currentExecutor(executor).parallelFor(0, partitions, fill, 1);
+        }
+        return tables;
+    }
+
+    template <typename K, typename V, typename LeftKey, typename Emit>
+    static auto probe(const function::Generator<E> &generator, const std::vector<collector::Table<K, V>> &tables, const LeftKey &leftKey, const function::Module &concurrent, pool::Executor *executor, const Emit &emit) -> void
+    {
+        bool stop = false;
+        auto lookup = [&tables, &leftKey](const E &element) -> const V * {
+            K key = std::invoke(leftKey, element);
+            return tables[partition(key, tables.size())].find(key);
+        };
+        if (concurrent < 2)
+        {
+            generator(
+                [&stop, &lookup, &emit](E element, function::Timestamp index) -> void {
+                    stop = emit(element, lookup(element));
+                },
+                [&stop](E element, function::Timestamp index) -> bool {
+                    return stop;
+                });
+            return;
+        }
+        const std::size_t window = static_cast<std::size_t>(concurrent) * 256;
+        std::vector<E> pending;
+        std::vector<const V *> matches;
+        pending.reserve(window);
+        auto flush = [&pending, &matches, &stop, &lookup, &emit, concurrent, executor]() -> void {
+            matches.assign(pending.size(), nullptr);
+            collector::currentExecutor(executor).parallelFor(
+                0, pending.size(),
+                [&pending, &matches, &lookup](std::size_t from, std::size_t to) -> void {
+                    for (std::size_t position = from; position < to; ++position)
+                    {
+                        matches[position] = lookup(pending[position]);
+                    }
+                },
+                std::max<std::size_t>(1, pending.size() / (static_cast<std::size_t>(concurrent) * 4)));
+            for (std::size_t position = 0; position < pending.size() && !stop; ++position)
+            {
+                stop = emit(pending[position], matches[position]);
+            }
+            pending.clear();
+        };
+        generator(
+            [&pending, &flush, window](E element, function::Timestamp index) -> void {
+                pending.push_back(std::move(element));
+                if (pending.size() == window)
+                {
+                    flush();
+                }
+            },
+            [&stop](E element, function::Timestamp index) -> bool {
+                return stop;
+            });
+        if (!stop && !pending.empty())
+        {
+            flush();
+        }
+    }
+
+    template <typename R, typename LeftKey, typename RightKey>
+    auto screen(const char *name, const Semantic<R> &other, LeftKey &&leftKey, RightKey &&rightKey, const bool &keep) const -> Semantic<E>
+    {
+        using K = std::decay_t<std::invoke_result_t<LeftKey, const E &>>;
+        return this->stage(name, Semantic<E>(
+            [generator = *(this->generator), right = other.source(), leftKey = std::forward<LeftKey>(leftKey), rightKey = std::forward<RightKey>(rightKey), keep, concurrent = this->concurrent, executor = this->executor](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
+                std::vector<collector::Table<K, bool>> tables = build<K, bool>(right, rightKey, std::max<std::size_t>(concurrent, 1), executor, [](bool &present, R element) -> void { present = true; });
+                function::Timestamp count = 0LL;
+                probe<K, bool>(generator, tables, leftKey, concurrent, executor, [&accept, &interrupt, &count, keep](const E &element, const bool *present) -> bool {
+                    if ((present != nullptr) != keep)
+                    {
+                        return false;
+                    }
+                    if (interrupt(element, count))
+                    {
+                        return true;
+                    }
+                    accept(element, count);
+                    count++;
+                    return false;
+                });
+            },
+            this->concurrent, this->executor),
+            this->traits.keep({Characteristic::sorted, Characteristic::distinct, Characteristic::ordered}));
+    }
+
+  public:
+    using Element = E;
+
+    Semantic(Semantic<E> &&other) noexcept = default;
+
+    Semantic(const function::Generator<E> &generator) : generator(std::make_unique<function::Generator<E>>(generator)), concurrent(1) {}
+
+    Semantic(const function::Generator<E> &generator, const function::Module &concurrent, pool::Executor *executor = nullptr) : generator(std::make_unique<function::Generator<E>>(generator)), concurrent(concurrent), executor(executor) {}
+
+    Semantic(const function::Generator<E> &generator, const Characteristics &characteristics) : generator(std::make_unique<function::Generator<E>>(generator)), concurrent(1), traits(characteristics) {}
+
+    Semantic(const function::Generator<E> &generator, const Characteristics &characteristics, const function::Function<function::Module, E> &at) : generator(std::make_unique<function::Generator<E>>(generator)), concurrent(1), traits(characteristics)
+    {
+        std::shared_ptr<Fusion> access = std::make_shared<Fusion>();
+        access->base = generator;
+        access->at = at;
+        access->extent = characteristics.size;
+        fusion = access;
+    }
+
+    Semantic(const Semantic<E> &other) : generator(std::make_unique<function::Generator<E>>(*other.generator)), concurrent(other.concurrent), executor(other.executor), profiler(other.profiler), row(other.row), plan(other.plan), traits(other.traits), fusion(other.fusion) {}
+
+    Semantic<E> &operator=(const Semantic<E> &other)
+    {
+        if (this != &other)
+        {
+            generator = std::make_unique<function::Generator<E>>(*other.generator);
+            concurrent = other.concurrent;
+            executor = other.executor;
+            profiler = other.profiler;
+            row = other.row;
+            plan = other.plan;
+            traits = other.traits;
+            fusion = other.fusion;
+        }
+        return *this;
+    }
+
+    Semantic<E> &operator=(Semantic<E> &&other) noexcept = default;
+
+    virtual ~Semantic() = default;
+
+    template <typename R, typename LeftKey, typename RightKey>
+    auto antiJoin(const Semantic<R> &other, LeftKey &&leftKey, RightKey &&rightKey) const -> Semantic<E>
+    {
+        return this->screen(__func__, other, std::forward<LeftKey>(leftKey), std::forward<RightKey>(rightKey), false);
+    }
+
+    auto async(const function::Module &bufferSize) const -> Semantic<E>
+    {
+        if (bufferSize == 0)
+        {
+            throw std::invalid_argument("async: buffer size must be positive");
+        }
+        return this->stage(__func__, Semantic<E>(
+            [generator = *(this->generator), bufferSize](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
+                pool::Channel<std::pair<E, function::Timestamp>> channel(bufferSize);
+                std::exception_ptr failure;
+                const pool::CancellationToken *token = pool::CancellationToken::current();
+                std::thread producer([&generator, &channel, &failure, token]() -> void {
+                    pool::CancellationScope scope(token);
+                    try
+                    {
+                        generator(
+                            [&channel](E element, function::Timestamp index) -> void {
+                                channel.push(std::make_pair(std::move(element), index));
+                            },
+                            [&channel, token](E element, function::Timestamp index) -> bool {
+                                return channel.cancelled() || (token != nullptr && token->cancelled());
+                            });
+                    }
+                    catch (...)
+                    {
+                        failure = std::current_exception();
+                    }
+                    channel.close();
+                });
+                try
+                {
+                    while (std::optional<std::pair<E, function::Timestamp>> item = channel.pop())
+                    {
+                        if (interrupt(item->first, item->second))
+                        {
+                            break;
+                        }
+                        accept(std::move(item->first), item->second);
+                    }
+                }
+                catch (...)
+                {
+                    channel.abort();
+                    producer.join();
+                    throw;
+                }
+                channel.abort();
+                producer.join();
+                if (failure)
+                {
+                    std::rethrow_exception(failure);
+                }
+            },
+            this->concurrent, this->executor),
+            this->traits.keep({Characteristic::sized, Characteristic::sorted, Characteristic::distinct, Characteristic::ordered}));
+    }
+
+    template <typename Container>
+    auto concatenate(Container &&container) const -> Semantic<E>
+    {
+        if constexpr (std::is_same_v<std::decay_t<Container>, Semantic<E>>)
+        {
+            return this->stage(__func__, Semantic<E>(
+                [generator = *(this->generator), other = std::forward<Container>(container)](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
+                    function::Timestamp count = 0LL;
+                    bool stop = false;
+                    generator(
+                        [&accept, &count](E element, function::Timestamp index) -> void {
+                            accept(element, count);
+                            count++;
+                        },
+                        [&stop](E element, function::Timestamp index) -> bool {
+                            return stop;
+                        });
+                    other.source()(
+                        [&accept, &count](E element, function::Timestamp index) -> void {
+                            accept(element, count);
+                            count++;
+                        },
+                        [&interrupt, &stop, &count](E element, function::Timestamp index) -> bool {
+                            if (interrupt(element, count))
+                            {
+                                stop = true;
+                                return true;
+                            }
+                            return false;
+                        });
+                },
+                this->concurrent, this->executor));
+        }
+        else if constexpr (std::is_same_v<std::decay_t<Container>, E>)
+        {
+            return this->stage(__func__, Semantic<E>(
+                [generator = *(this->generator), element = std::forward<Container>(container)](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
+                    function::Timestamp count = 0LL;
+                    generator(
+                        [&accept, &count](E current, function::Timestamp index) -> void {
+                            accept(current, count);
+                            count++;
+                        },
                         [&interrupt, &count](E current, function::Timestamp index) -> bool {
                             return interrupt(current, count);
                         });
@@ -1060,11 +1959,11 @@ class Semantic
                         accept(element, count);
                     }
                 },
-                this->concurrent);
+                this->concurrent, this->executor));
         }
         else if constexpr (std::is_invocable_v<std::decay_t<Container>, function::BiConsumer<E, function::Timestamp>, function::BiPredicate<E, function::Timestamp>>)
         {
-            return Semantic<E>(
+            return this->stage(__func__, Semantic<E>(
                 [generator = *(this->generator), other = std::forward<Container>(container)](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
                     function::Timestamp count = 0LL;
                     bool stop = false;
@@ -1090,11 +1989,11 @@ class Semantic
                             return false;
                         });
                 },
-                this->concurrent);
+                this->concurrent, this->executor));
         }
         else
         {
-            return Semantic<E>(
+            return this->stage(__func__, Semantic<E>(
                 [generator = *(this->generator), elements = std::forward<Container>(container)](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
                     function::Timestamp count = 0LL;
                     generator(
@@ -1115,13 +2014,47 @@ class Semantic
                         count++;
                     }
                 },
-                this->concurrent);
+                this->concurrent, this->executor));
         }
     }
 
     auto distinct() const -> Semantic<E>
     {
-        return Semantic<E>(
+        Characteristics characteristics = this->traits.keep({Characteristic::sorted, Characteristic::ordered}).with(Characteristic::distinct);
+        if (this->traits.has(Characteristic::distinct))
+        {
+            Semantic<E> next = this->stage(__func__, Semantic<E>(*this->generator, this->concurrent, this->executor), characteristics);
+            next.plan = std::make_shared<const Plan>(Plan{__func__, "elided: input already distinct", this->plan});
+            return next;
+        }
+        if constexpr (std::is_invocable_v<std::less<E>, E, E>)
+        {
+            if (this->traits.has(Characteristic::sorted))
+            {
+                Semantic<E> next = this->stage(__func__, Semantic<E>(
+                    [generator = *(this->generator)](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
+                        std::optional<E> previous;
+                        function::Timestamp count = 0LL;
+                        generator(
+                            [&accept, &previous, &count](E element, function::Timestamp index) -> void {
+                                if (!previous.has_value() || *previous < element)
+                                {
+                                    previous = element;
+                                    accept(element, count);
+                                    count++;
+                                }
+                            },
+                            [&interrupt, &count](E element, function::Timestamp index) -> bool {
+                                return interrupt(element, count);
+                            });
+                    },
+                    this->concurrent, this->executor),
+                    characteristics);
+                next.plan = std::make_shared<const Plan>(Plan{__func__, "adjacent dedup on sorted input", this->plan});
+                return next;
+            }
+        }
+        return this->stage(__func__, Semantic<E>(
             [generator = *(this->generator)](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
                 std::unordered_set<E> seen;
                 function::Timestamp count = 0LL;
@@ -1138,12 +2071,13 @@ class Semantic
                         return interrupt(element, count);
                     });
             },
-            this->concurrent);
+            this->concurrent, this->executor),
+            characteristics);
     }
 
     auto distinct(const function::Comparator<E> &comparator) const -> Semantic<E>
     {
-        return Semantic<E>(
+        return this->stage(__func__, Semantic<E>(
             [generator = *(this->generator), comparator](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
                 std::set<E, function::Comparator<E>> seen(comparator);
                 function::Timestamp count = 0LL;
@@ -1160,13 +2094,14 @@ class Semantic
                         return interrupt(element, count);
                     });
             },
-            this->concurrent);
+            this->concurrent, this->executor),
+            this->traits.keep({Characteristic::sorted, Characteristic::ordered}));
     }
 
     template <typename Predicate>
     auto dropWhile(Predicate &&predicate) const -> Semantic<E>
     {
-        return Semantic<E>(
+        return this->stage(__func__, Semantic<E>(
             [generator = *(this->generator), predicate = std::forward<Predicate>(predicate), this](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
                 bool dropping = true;
                 function::Timestamp count = 0LL;
@@ -1191,13 +2126,63 @@ class Semantic
                         return interrupt(element, count);
                     });
             },
-            this->concurrent);
+            this->concurrent, this->executor),
+            this->traits.keep({Characteristic::sorted, Characteristic::distinct, Characteristic::ordered}));
+    }
+
+    auto characteristics() const -> Characteristics
+    {
+        return this->traits;
+    }
+
+    auto count() const -> function::Module
+    {
+        if (this->traits.has(Characteristic::sized) && this->profiler == nullptr)
+        {
+            return this->traits.size;
+        }
+        function::Module count = 0;
+        const pool::CancellationToken *token = pool::CancellationToken::current();
+        (*this->generator)(
+            [&count](E element, function::Timestamp index) -> void {
+                count++;
+            },
+            [token](E element, function::Timestamp index) -> bool {
+                return token != nullptr && token->cancelled();
+            });
+        if (token != nullptr)
+        {
+            token->check();
+        }
+        return count;
+    }
+
+    auto explain() const -> std::string
+    {
+        return semantic::explain(this->plan);
     }
 
     template <typename Predicate>
     auto filter(Predicate &&predicate) const -> Semantic<E>
     {
-        return Semantic<E>(
+        std::shared_ptr<Fusion> fusion;
+        if (this->profiler == nullptr)
+        {
+            fusion = std::make_shared<Fusion>();
+            if (this->fusion != nullptr && !this->fusion->predicates.empty())
+            {
+                *fusion = *this->fusion;
+                fusion->predicates.push_back(erase(std::decay_t<Predicate>(predicate)));
+                Semantic<E> next(fuse(fusion), this->concurrent, this->executor);
+                next.fusion = fusion;
+                next.plan = std::make_shared<const Plan>(Plan{__func__, "fused " + std::to_string(fusion->predicates.size()) + " filters", this->plan == nullptr ? nullptr : this->plan->upstream});
+                next.traits = this->traits.keep({Characteristic::sorted, Characteristic::distinct, Characteristic::ordered});
+                return next;
+            }
+            fusion->base = *this->generator;
+            fusion->predicates.push_back(erase(std::decay_t<Predicate>(predicate)));
+        }
+        Semantic<E> next = this->stage(__func__, Semantic<E>(
             [generator = *(this->generator), predicate = std::forward<Predicate>(predicate), this](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) mutable -> void {
                 function::Timestamp count = 0;
                 generator(
@@ -1212,14 +2197,17 @@ class Semantic
                         return interrupt(element, count);
                     });
             },
-            this->concurrent);
+            this->concurrent, this->executor),
+            this->traits.keep({Characteristic::sorted, Characteristic::distinct, Characteristic::ordered}));
+        next.fusion = fusion;
+        return next;
     }
 
     template <typename T = E, typename = typename T::Element>
     auto flat() const -> Semantic<typename T::Element>
     {
         using InnerType = typename T::Element;
-        return Semantic<InnerType>(
+        return this->stage(__func__, Semantic<InnerType>(
             [generator = *(this->generator)](function::BiConsumer<InnerType, function::Timestamp> accept, function::BiPredicate<InnerType, function::Timestamp> interrupt) -> void {
                 function::Timestamp count = 0LL;
                 bool stop = false;
@@ -1238,14 +2226,14 @@ class Semantic
                         return stop;
                     });
             },
-            this->concurrent);
+            this->concurrent, this->executor));
     }
 
     template <typename T = E, typename = std::void_t<decltype(std::begin(std::declval<T>()))>>
     auto flat() const -> Semantic<std::decay_t<decltype(*std::begin(std::declval<T>()))>>
     {
         using InnerType = std::decay_t<decltype(*std::begin(std::declval<T>()))>;
-        return Semantic<InnerType>(
+        return this->stage(__func__, Semantic<InnerType>(
             [generator = *(this->generator)](function::BiConsumer<InnerType, function::Timestamp> accept, function::BiPredicate<InnerType, function::Timestamp> interrupt) -> void {
                 function::Timestamp count = 0LL;
                 bool stop = false;
@@ -1270,7 +2258,7 @@ class Semantic
                         return stop;
                     });
             },
-            this->concurrent);
+            this->concurrent, this->executor));
     }
 
     template <typename Flatten>
@@ -1278,7 +2266,7 @@ class Semantic
     {
         using InnerSemantic = std::decay_t<decltype(this->invoke(std::forward<Flatten>(flatten), std::declval<E>(), std::declval<function::Timestamp>()))>;
         using InnerType = typename InnerSemantic::Element;
-        return Semantic<InnerType>(
+        return this->stage(__func__, Semantic<InnerType>(
             [generator = *(this->generator), flatten = std::forward<Flatten>(flatten), this](function::BiConsumer<InnerType, function::Timestamp> accept, function::BiPredicate<InnerType, function::Timestamp> interrupt) -> void {
                 function::Timestamp count = 0LL;
                 bool stop = false;
@@ -1303,7 +2291,7 @@ class Semantic
                         return stop;
                     });
             },
-            this->concurrent);
+            this->concurrent, this->executor));
     }
 
     template <typename Flatten>
@@ -1311,7 +2299,7 @@ class Semantic
     {
         using InnerSemantic = std::decay_t<decltype(this->invoke(std::forward<Flatten>(flatten), std::declval<E>(), std::declval<function::Timestamp>()))>;
         using InnerType = typename InnerSemantic::Element;
-        return Semantic<InnerType>(
+        return this->stage(__func__, Semantic<InnerType>(
             [generator = *(this->generator), flatten = std::forward<Flatten>(flatten), this](function::BiConsumer<InnerType, function::Timestamp> accept, function::BiPredicate<InnerType, function::Timestamp> interrupt) -> void {
                 function::Timestamp count = 0LL;
                 bool stop = false;
@@ -1331,7 +2319,7 @@ class Semantic
                         return stop;
                     });
             },
-            this->concurrent);
+            this->concurrent, this->executor));
     }
 
     auto getConcurrent() const -> function::Module
@@ -1356,21 +2344,41 @@ class Semantic
         }
     }
 
-    auto limit(const function::Module &limit) const -> Semantic<E>
+    template <typename R, typename LeftKey, typename RightKey, typename Combiner>
+    auto join(const Semantic<R> &other, LeftKey &&leftKey, RightKey &&rightKey, Combiner &&combiner) const
     {
-        return Semantic<E>(
-            [generator = *(this->generator), limit](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
-                function::Module count = 0;
-                generator(
-                    [&accept, &count](E element, function::Timestamp index) -> void {
-                        accept(element, count);
+        using K = std::decay_t<std::invoke_result_t<LeftKey, const E &>>;
+        using Result = std::decay_t<std::invoke_result_t<Combiner, const E &, const R &>>;
+        static_assert(!std::is_same_v<Result, void>, "Combiner must not return void");
+        return this->stage(__func__, Semantic<Result>(
+            [generator = *(this->generator), right = other.source(), leftKey = std::forward<LeftKey>(leftKey), rightKey = std::forward<RightKey>(rightKey), combiner = std::forward<Combiner>(combiner), concurrent = this->concurrent, executor = this->executor](function::BiConsumer<Result, function::Timestamp> accept, function::BiPredicate<Result, function::Timestamp> interrupt) -> void {
+                std::vector<collector::Table<K, std::vector<R>>> tables = build<K, std::vector<R>>(right, rightKey, std::max<std::size_t>(concurrent, 1), executor, [](std::vector<R> &matches, R element) -> void { matches.push_back(std::move(element)); });
+                function::Timestamp count = 0LL;
+                probe<K, std::vector<R>>(generator, tables, leftKey, concurrent, executor, [&accept, &interrupt, &combiner, &count](const E &element, const std::vector<R> *matches) -> bool {
+                    if (matches == nullptr)
+                    {
+                        return false;
+                    }
+                    for (const R &match : *matches)
+                    {
+                        Result result = std::invoke(combiner, element, match);
+                        if (interrupt(result, count))
+                        {
+                            return true;
+                        }
+                        accept(result, count);
                         count++;
-                    },
-                    [&interrupt, &count, &limit](E element, function::Timestamp index) -> bool {
-                        return interrupt(element, count) || count >= limit;
-                    });
+                    }
+                    return false;
+                });
             },
-            this->concurrent);
+            this->concurrent, this->executor),
+            this->traits.keep({Characteristic::ordered}));
+    }
+
+    auto limit(const function::Module &limit) const -> Semantic<E>
+    {
+        return this->slice("limit(" + std::to_string(limit) + ")", 0, limit);
     }
 
     template <typename Mapper>
@@ -1378,7 +2386,7 @@ class Semantic
     {
         using Result = std::decay_t<decltype(this->invoke(std::forward<Mapper>(mapper), std::declval<E>(), std::declval<function::Timestamp>()))>;
         static_assert(!std::is_same_v<Result, void>, "Mapper must not return void");
-        return Semantic<Result>(
+        return this->stage(__func__, Semantic<Result>(
             [generator = *(this->generator), mapper = std::forward<Mapper>(mapper), this](function::BiConsumer<Result, function::Timestamp> accept, function::BiPredicate<Result, function::Timestamp> interrupt) -> void {
                 bool stop = false;
                 generator(
@@ -1391,23 +2399,84 @@ class Semantic
                         return stop;
                     });
             },
-            this->concurrent);
+            this->concurrent, this->executor),
+            this->traits.keep({Characteristic::sized, Characteristic::ordered}));
+    }
+
+    template <typename Mapper>
+    auto parallelMap(Mapper &&mapper, const function::Module &concurrent) const
+    {
+        using Result = std::decay_t<decltype(this->invoke(std::forward<Mapper>(mapper), std::declval<E>(), std::declval<function::Timestamp>()))>;
+        static_assert(!std::is_same_v<Result, void>, "Mapper must not return void");
+        if (concurrent == 0)
+        {
+            throw std::invalid_argument("parallelMap: concurrency must be positive");
+        }
+        return this->stage(__func__, Semantic<Result>(
+            [generator = *(this->generator), mapper = std::forward<Mapper>(mapper), concurrent, executor = this->executor, this](function::BiConsumer<Result, function::Timestamp> accept, function::BiPredicate<Result, function::Timestamp> interrupt) -> void {
+                const std::size_t window = static_cast<std::size_t>(concurrent) * 64;
+                std::vector<std::pair<E, function::Timestamp>> pending;
+                std::vector<std::optional<Result>> mapped;
+                pending.reserve(window);
+                bool stop = false;
+                auto flush = [&pending, &mapped, &stop, &accept, &interrupt, &mapper, concurrent, executor, this]() -> void {
+                    mapped.clear();
+                    mapped.resize(pending.size());
+                    collector::currentExecutor(executor).parallelFor(
+                        0, pending.size(),
+                        [&pending, &mapped, &mapper, this](std::size_t from, std::size_t to) -> void {
+                            for (std::size_t position = from; position < to; ++position)
+                            {
+                                mapped[position].emplace(this->invoke(mapper, pending[position].first, pending[position].second));
+                            }
+                        },
+                        std::max<std::size_t>(1, pending.size() / (static_cast<std::size_t>(concurrent) * 4)));
+                    for (std::size_t position = 0; position < pending.size() && !stop; ++position)
+                    {
+                        accept(*mapped[position], pending[position].second);
+                        stop = interrupt(*mapped[position], pending[position].second);
+                    }
+                    pending.clear();
+                };
+                generator(
+                    [&pending, &flush, window](E element, function::Timestamp index) -> void {
+                        pending.emplace_back(std::move(element), index);
+                        if (pending.size() == window)
+                        {
+                            flush();
+                        }
+                    },
+                    [&stop](E element, function::Timestamp index) -> bool {
+                        return stop;
+                    });
+                if (!stop && !pending.empty())
+                {
+                    flush();
+                }
+            },
+            this->concurrent, this->executor),
+            this->traits.keep({Characteristic::sized, Characteristic::ordered}));
     }
 
     auto parallel() const -> Semantic<E>
     {
-        return Semantic<E>(this->source(), 1);
+        return this->inherit(Semantic<E>(this->source(), 1, this->executor));
     }
 
     auto parallel(const function::Module &concurrent) const -> Semantic<E>
     {
-        return Semantic<E>(this->source(), std::max(concurrent, 1ULL));
+        return this->inherit(Semantic<E>(this->source(), std::max(concurrent, 1ULL), this->executor));
+    }
+
+    auto parallel(const function::Module &concurrent, pool::Executor &executor) const -> Semantic<E>
+    {
+        return this->inherit(Semantic<E>(this->source(), std::max(concurrent, 1ULL), &executor));
     }
 
     template <typename Consumer>
     auto peek(Consumer &&consumer) const -> Semantic<E>
     {
-        return Semantic<E>(
+        return this->stage(__func__, Semantic<E>(
             [generator = *(this->generator), consumer = std::forward<Consumer>(consumer)](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
                 generator(
                     [&accept, &consumer](E element, function::Timestamp index) -> void {
@@ -1427,12 +2496,32 @@ class Semantic
                     },
                     interrupt);
             },
-            this->concurrent);
+            this->concurrent, this->executor),
+            this->traits.keep({Characteristic::sized, Characteristic::sorted, Characteristic::distinct, Characteristic::ordered}));
+    }
+
+    auto profile(std::ostream &out = std::cerr) const -> Semantic<E>
+    {
+        return this->profile(std::make_shared<collector::Profile>(&out));
+    }
+
+    auto profile(const std::shared_ptr<collector::Profile> &profiler) const -> Semantic<E>
+    {
+        Semantic<E> result(*this);
+        if (profiler == nullptr)
+        {
+            return result;
+        }
+        collector::Profile::Row &record = profiler->stage("source");
+        *result.generator = collector::Profile::instrument(profiler, record, std::move(*result.generator));
+        result.profiler = profiler;
+        result.row = &record;
+        return result;
     }
 
     auto redirect(const function::BiFunction<E, function::Timestamp, E> &redirector) const -> Semantic<E>
     {
-        return Semantic<E>(
+        return this->stage(__func__, Semantic<E>(
             [generator = *(this->generator), redirector](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
                 generator(
                     [&accept, &redirector](E element, function::Timestamp index) -> void {
@@ -1442,12 +2531,13 @@ class Semantic
                         return interrupt(redirector(element, index), index);
                     });
             },
-            this->concurrent);
+            this->concurrent, this->executor),
+            this->traits.keep({Characteristic::sized}));
     }
 
     auto reverse() const -> Semantic<E>
     {
-        return Semantic<E>(
+        return this->stage(__func__, Semantic<E>(
             [generator = *(this->generator)](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
                 generator(
                     [&accept](E element, function::Timestamp index) -> void {
@@ -1457,49 +2547,49 @@ class Semantic
                         return interrupt(element, -index);
                     });
             },
-            this->concurrent);
+            this->concurrent, this->executor),
+            this->traits.keep({Characteristic::sized, Characteristic::distinct}));
+    }
+
+    template <typename R, typename LeftKey, typename RightKey>
+    auto semiJoin(const Semantic<R> &other, LeftKey &&leftKey, RightKey &&rightKey) const -> Semantic<E>
+    {
+        return this->screen(__func__, other, std::forward<LeftKey>(leftKey), std::forward<RightKey>(rightKey), true);
     }
 
     auto skip(const function::Module &skip) const -> Semantic<E>
     {
-        return Semantic<E>(
-            [generator = *(this->generator), skip](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
-                function::Module count = 0;
-                generator(
-                    [&accept, &count, &skip](E element, function::Timestamp index) -> void {
-                        if (count >= skip)
-                        {
-                            accept(element, count);
-                        }
-                        count++;
-                    },
-                    [&interrupt, &count](E element, function::Timestamp index) -> bool {
-                        return interrupt(element, count);
-                    });
-            },
-            this->concurrent);
+        return this->slice("skip(" + std::to_string(skip) + ")", skip, std::numeric_limits<function::Module>::max());
     }
 
     auto sort() const -> collectable::OrderedCollectable<E>
     {
         if constexpr (std::is_invocable_v<std::less<E>, E, E>)
         {
-            return collectable::OrderedCollectable<E>(
-                this->source(),
-                [](const E &left, const E &right) -> bool { return left < right; },
-                this->concurrent);
+            return this->materialize<collectable::OrderedCollectable<E>>(__func__, [this]() -> collectable::OrderedCollectable<E> {
+                collectable::OrderedCollectable<E> result(
+                    this->source(),
+                    [](const E &left, const E &right) -> bool { return left < right; },
+                    this->concurrent, this->executor);
+                result.pending->presorted = this->traits.has(Characteristic::sorted) && this->traits.has(Characteristic::ordered);
+                return result;
+            });
         }
         else
         {
-            return collectable::OrderedCollectable<E>(
-                this->source(),
-                this->concurrent);
+            return this->materialize<collectable::OrderedCollectable<E>>(__func__, [this]() -> collectable::OrderedCollectable<E> {
+                return collectable::OrderedCollectable<E>(
+                    this->source(),
+                    this->concurrent, this->executor);
+            });
         }
     }
 
     auto sort(const function::Comparator<E> &comparator) const -> collectable::OrderedCollectable<E>
     {
-        return collectable::OrderedCollectable<E>(this->source(), comparator, this->concurrent);
+        return this->materialize<collectable::OrderedCollectable<E>>(__func__, [this, &comparator]() -> collectable::OrderedCollectable<E> {
+            return collectable::OrderedCollectable<E>(this->source(), comparator, this->concurrent, this->executor);
+        });
     }
 
     auto source() const -> function::Generator<E>
@@ -1511,28 +2601,13 @@ class Semantic
 
     auto sub(const function::Module &start, const function::Module &end) const -> Semantic<E>
     {
-        return Semantic<E>(
-            [generator = *(this->generator), start, end](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
-                function::Module count = 0;
-                generator(
-                    [&accept, &count, &start, &end](E element, function::Timestamp index) -> void {
-                        if (count >= start && count < end)
-                        {
-                            accept(element, count);
-                        }
-                        count++;
-                    },
-                    [&interrupt, &count, &end](E element, function::Timestamp index) -> bool {
-                        return interrupt(element, count) || count >= end;
-                    });
-            },
-            this->concurrent);
+        return this->slice("sub(" + std::to_string(start) + ", " + std::to_string(end) + ")", start, end);
     }
 
     template <typename Predicate>
     auto takeWhile(Predicate &&predicate) const -> Semantic<E>
     {
-        return Semantic<E>(
+        return this->stage(__func__, Semantic<E>(
             [generator = *(this->generator), predicate = std::forward<Predicate>(predicate), this](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
                 bool stop = false;
                 generator(
@@ -1550,33 +2625,42 @@ class Semantic
                         return interrupt(element, index) || stop;
                     });
             },
-            this->concurrent);
+            this->concurrent, this->executor),
+            this->traits.keep({Characteristic::sorted, Characteristic::distinct, Characteristic::ordered}));
     }
 
     auto toOrdered() const -> collectable::OrderedCollectable<E>
     {
-        return collectable::OrderedCollectable<E>(this->source(), this->concurrent);
+        return this->materialize<collectable::OrderedCollectable<E>>(__func__, [this]() -> collectable::OrderedCollectable<E> {
+            return collectable::OrderedCollectable<E>(this->source(), this->concurrent, this->executor);
+        });
     }
 
     template <typename Distribution>
     auto toStatistics() const -> collectable::Statistics<E, Distribution>
     {
-        return collectable::Statistics<E, Distribution>(this->source(), this->concurrent);
+        return this->materialize<collectable::Statistics<E, Distribution>>(__func__, [this]() -> collectable::Statistics<E, Distribution> {
+            return collectable::Statistics<E, Distribution>(this->source(), this->concurrent, this->executor);
+        });
     }
 
     auto toUnordered() const -> collectable::UnorderedCollectable<E>
     {
-        return collectable::UnorderedCollectable<E>(this->source(), this->concurrent);
+        return this->materialize<collectable::UnorderedCollectable<E>>(__func__, [this]() -> collectable::UnorderedCollectable<E> {
+            return collectable::UnorderedCollectable<E>(this->source(), this->concurrent, this->executor);
+        });
     }
 
     auto toWindow() const -> collectable::WindowCollectable<E>
     {
-        return collectable::WindowCollectable<E>(this->source(), this->concurrent);
+        return this->materialize<collectable::WindowCollectable<E>>(__func__, [this]() -> collectable::WindowCollectable<E> {
+            return collectable::WindowCollectable<E>(this->source(), this->concurrent, this->executor);
+        });
     }
 
     auto translate(const function::Timestamp &offset) const -> Semantic<E>
     {
-        return Semantic<E>(
+        return this->stage(__func__, Semantic<E>(
             [generator = *(this->generator), offset](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
                 generator(
                     [&accept, &offset](E element, function::Timestamp index) -> void {
@@ -1586,7 +2670,8 @@ class Semantic
                         return interrupt(element, index + offset);
                     });
             },
-            this->concurrent);
+            this->concurrent, this->executor),
+            this->traits.keep({Characteristic::sized, Characteristic::sorted, Characteristic::distinct, Characteristic::ordered}));
     }
 };
 } // namespace semantic
@@ -1594,7 +2679,7 @@ class Semantic
 template <typename E>
 auto collectable::WindowCollectable<E>::slide(const function::Module &size, const function::Timestamp &step) const -> semantic::Semantic<semantic::Semantic<E>>
 {
-    return semantic::Semantic<semantic::Semantic<E>>([buffer = this->buffer, size, step](auto accept, auto interrupt) -> void {
+    return semantic::Semantic<semantic::Semantic<E>>([buffer = this->ordered(), size, step](auto accept, auto interrupt) -> void {
         function::Module total = buffer.size();
         function::Module outerIndex = 0LL;
         bool stop = false;
@@ -1639,13 +2724,255 @@ auto collectable::WindowCollectable<E>::slide(const function::Module &size, cons
             }
         }
     },
-                                                     this->concurrent);
+                                                     this->concurrent, this->executor);
+}
+
+template <typename E>
+template <typename A, typename R>
+auto collectable::WindowCollectable<E>::slideAggregate(const function::Module &size, const function::Timestamp &step, const function::Supplier<A> &identity, const function::BiFunction<A, E, A> &accumulator, const function::BiFunction<A, E, A> &retractor, const function::Function<A, R> &finisher) const -> semantic::Semantic<R>
+{
+    if (size == 0 || step < 1)
+    {
+        throw std::invalid_argument("Window size and step must be positive.");
+    }
+    return semantic::Semantic<R>([values = this->contiguous(), size, step, identity, accumulator, retractor, finisher](auto accept, auto interrupt) -> void {
+        function::Module total = values.size();
+        function::Module low = 0;
+        function::Module high = 0;
+        function::Timestamp outerIndex = 0LL;
+        A state = identity();
+        for (function::Module start = 0; start < total; start += step)
+        {
+            function::Module end = std::min(start + size, total);
+            if (start >= high)
+            {
+                state = identity();
+                low = start;
+                high = start;
+            }
+            for (; low < start; ++low)
+            {
+                state = retractor(std::move(state), values[low]);
+            }
+            for (; high < end; ++high)
+            {
+                state = accumulator(std::move(state), values[high]);
+            }
+            R result = finisher(state);
+            if (interrupt(result, outerIndex))
+            {
+                break;
+            }
+            accept(result, outerIndex);
+            outerIndex++;
+        }
+    },
+                                 this->concurrent, this->executor);
+}
+
+template <typename E>
+template <typename A>
+auto collectable::WindowCollectable<E>::slideReduce(const function::Module &size, const function::Timestamp &step, const function::Function<E, A> &mapper, const function::BiFunction<A, A, A> &combiner) const -> semantic::Semantic<A>
+{
+    if (size == 0 || step < 1)
+    {
+        throw std::invalid_argument("Window size and step must be positive.");
+    }
+    return semantic::Semantic<A>([values = this->contiguous(), size, step, mapper, combiner](auto accept, auto interrupt) -> void {
+        function::Module total = values.size();
+        function::Module low = 0;
+        function::Module high = 0;
+        function::Timestamp outerIndex = 0LL;
+        std::vector<A> front;
+        std::optional<A> back;
+        for (function::Module start = 0; start < total; start += step)
+        {
+            function::Module end = std::min(start + size, total);
+            if (start >= high)
+            {
+                front.clear();
+                back.reset();
+                low = start;
+                high = start;
+            }
+            for (; low < start; ++low)
+            {
+                if (front.empty())
+                {
+                    for (function::Module index = high; index > low; --index)
+                    {
+                        A value = mapper(values[index - 1]);
+                        front.push_back(front.empty() ? std::move(value) : combiner(std::move(value), front.back()));
+                    }
+                    back.reset();
+                }
+                front.pop_back();
+            }
+            for (; high < end; ++high)
+            {
+                A value = mapper(values[high]);
+                back = back.has_value() ? combiner(std::move(back.value()), std::move(value)) : std::move(value);
+            }
+            A result = front.empty() ? back.value() : (back.has_value() ? combiner(front.back(), back.value()) : front.back());
+            if (interrupt(result, outerIndex))
+            {
+                break;
+            }
+            accept(result, outerIndex);
+            outerIndex++;
+        }
+    },
+                                 this->concurrent, this->executor);
+}
+
+template <typename E>
+auto collectable::WindowCollectable<E>::extremum(const function::Module &size, const function::Timestamp &step, const function::Comparator<E> &comparator) const -> semantic::Semantic<E>
+{
+    if (size == 0 || step < 1)
+    {
+        throw std::invalid_argument("Window size and step must be positive.");
+    }
+    return semantic::Semantic<E>([values = this->contiguous(), size, step, comparator](auto accept, auto interrupt) -> void {
+        function::Module total = values.size();
+        function::Module high = 0;
+        function::Timestamp outerIndex = 0LL;
+        std::deque<function::Module> candidates;
+        for (function::Module start = 0; start < total; start += step)
+        {
+            function::Module end = std::min(start + size, total);
+            if (start >= high)
+            {
+                candidates.clear();
+                high = start;
+            }
+            while (!candidates.empty() && candidates.front() < start)
+            {
+                candidates.pop_front();
+            }
+            for (; high < end; ++high)
+            {
+                while (!candidates.empty() && comparator(values[high], values[candidates.back()]))
+                {
+                    candidates.pop_back();
+                }
+                candidates.push_back(high);
+            }
+            if (interrupt(values[candidates.front()], outerIndex))
+            {
+                break;
+            }
+            accept(values[candidates.front()], outerIndex);
+            outerIndex++;
+        }
+    },
+                                 this->concurrent, this->executor);
+}
+
+template <typename E>
+auto collectable::WindowCollectable<E>::slideCount(const function::Module &size, const function::Timestamp &step) const -> semantic::Semantic<function::Module>
+{
+    return this->slideAggregate<function::Module, function::Module>(
+        size, step,
+        []() -> function::Module { return 0; },
+        [](function::Module count, const E &element) -> function::Module { return count + 1; },
+        [](function::Module count, const E &element) -> function::Module { return count - 1; },
+        [](const function::Module &count) -> function::Module { return count; });
+}
+
+template <typename E>
+template <typename D>
+auto collectable::WindowCollectable<E>::slideSummate(const function::Module &size, const function::Timestamp &step) const -> semantic::Semantic<D>
+{
+    return this->slideAggregate<D, D>(
+        size, step,
+        []() -> D { return D{}; },
+        [](D sum, const E &element) -> D { return sum + static_cast<D>(element); },
+        [](D sum, const E &element) -> D { return sum - static_cast<D>(element); },
+        [](const D &sum) -> D { return sum; });
+}
+
+template <typename E>
+template <typename D>
+auto collectable::WindowCollectable<E>::slideAverage(const function::Module &size, const function::Timestamp &step) const -> semantic::Semantic<D>
+{
+    return this->slideAggregate<std::pair<D, function::Module>, D>(
+        size, step,
+        []() -> std::pair<D, function::Module> { return std::make_pair(D{}, 0); },
+        [](std::pair<D, function::Module> state, const E &element) -> std::pair<D, function::Module> { return std::make_pair(state.first + static_cast<D>(element), state.second + 1); },
+        [](std::pair<D, function::Module> state, const E &element) -> std::pair<D, function::Module> { return std::make_pair(state.first - static_cast<D>(element), state.second - 1); },
+        [](const std::pair<D, function::Module> &state) -> D { return state.second == 0 ? D{} : state.first / static_cast<D>(state.second); });
+}
+
+template <typename E>
+template <typename D>
+auto collectable::WindowCollectable<E>::slideVariance(const function::Module &size, const function::Timestamp &step) const -> semantic::Semantic<D>
+{
+    using Value = typename collector::Moments<D>::Value;
+    return this->slideAggregate<collector::Moments<D>, D>(
+        size, step,
+        []() -> collector::Moments<D> { return collector::Moments<D>(); },
+        [](collector::Moments<D> state, const E &element) -> collector::Moments<D> {
+            state.add(static_cast<Value>(element));
+            return state;
+        },
+        [](collector::Moments<D> state, const E &element) -> collector::Moments<D> {
+            state.remove(static_cast<Value>(element));
+            return state;
+        },
+        [](const collector::Moments<D> &state) -> D { return static_cast<D>(state.variance()); });
 }
 
 template <typename E>
 auto collectable::Collectable<E>::semantic() const -> semantic::Semantic<E>
 {
-    return semantic::Semantic<E>(this->source(), this->concurrent);
+    semantic::Semantic<E> result(this->source(), this->concurrent, this->executor);
+    result.plan = this->plan;
+    if (std::optional<function::Module> size = this->extent())
+    {
+        result.traits = semantic::Characteristics().sized(*size);
+    }
+    return result.profile(this->profiler);
+}
+
+template <typename E>
+auto collectable::OrderedCollectable<E>::semantic() const -> semantic::Semantic<E>
+{
+    if (this->profiler == nullptr && (this->pending == nullptr || this->pending->presorted))
+    {
+        bool positional = this->pending != nullptr;
+        std::shared_ptr<const std::vector<std::pair<function::Timestamp, E>>> values = positional ? std::shared_ptr<const std::vector<std::pair<function::Timestamp, E>>>(this->pending, &this->pending->values) : std::make_shared<const std::vector<std::pair<function::Timestamp, E>>>(this->buffer.begin(), this->buffer.end());
+        semantic::Semantic<E> result(
+            [values, positional](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
+                function::Module position = 0;
+                for (const auto &pair : *values)
+                {
+                    function::Timestamp index = positional ? static_cast<function::Timestamp>(position) : pair.first;
+                    if (interrupt(pair.second, index))
+                    {
+                        break;
+                    }
+                    accept(pair.second, index);
+                    ++position;
+                }
+            },
+            semantic::Characteristics::of({semantic::Characteristic::ordered}).sized(values->size()),
+            [values](const function::Module &position) -> E { return (*values)[position].second; });
+        result.concurrent = this->concurrent;
+        result.executor = this->executor;
+        result.plan = this->plan;
+        return result;
+    }
+    semantic::Semantic<E> result = Collectable<E>::semantic();
+    result.traits = result.traits.with(semantic::Characteristic::ordered);
+    if (this->pending != nullptr && !this->pending->presorted && this->profiler == nullptr)
+    {
+        auto fusion = std::make_shared<typename semantic::Semantic<E>::Fusion>();
+        fusion->base = *result.generator;
+        fusion->sorted = std::shared_ptr<const std::vector<std::pair<function::Timestamp, E>>>(this->pending, &this->pending->values);
+        fusion->comparator = this->pending->comparator;
+        result.fusion = fusion;
+    }
+    return result;
 }
 
 namespace semantic
@@ -1653,7 +2980,12 @@ namespace semantic
 template <typename D>
 auto useRange(const D &start, const D &end) -> Semantic<D>
 {
-    return Semantic<D>([startValue = std::min(start, end), endValue = std::max(start, end)](function::BiConsumer<D, function::Timestamp> accept, function::BiPredicate<D, function::Timestamp> interrupt) -> void {
+    Characteristics characteristics = Characteristics::of({Characteristic::sorted, Characteristic::distinct, Characteristic::ordered});
+    if constexpr (std::is_integral_v<D>)
+    {
+        characteristics = characteristics.sized(static_cast<function::Module>(std::max(start, end)) - static_cast<function::Module>(std::min(start, end)));
+    }
+    function::Generator<D> generator = [startValue = std::min(start, end), endValue = std::max(start, end)](function::BiConsumer<D, function::Timestamp> accept, function::BiPredicate<D, function::Timestamp> interrupt) -> void {
         function::Timestamp index = 0LL;
         for (D value = startValue; value < endValue; value++)
         {
@@ -1664,14 +2996,37 @@ auto useRange(const D &start, const D &end) -> Semantic<D>
             accept(value, index);
             index++;
         }
-    },
-                       1ULL);
+    };
+    if constexpr (std::is_integral_v<D>)
+    {
+        return Semantic<D>(generator, characteristics, [startValue = std::min(start, end)](const function::Module &position) -> D { return static_cast<D>(startValue + static_cast<D>(position)); });
+    }
+    else
+    {
+        return Semantic<D>(generator, characteristics);
+    }
 }
 
 template <typename D>
 auto useRange(const D &start, const D &end, const D &step) -> Semantic<D>
 {
-    return Semantic<D>([startValue = start, endValue = end, stepValue = step](function::BiConsumer<D, function::Timestamp> accept, function::BiPredicate<D, function::Timestamp> interrupt) -> void {
+    Characteristics characteristics = step > D{} ? Characteristics::of({Characteristic::sorted, Characteristic::distinct, Characteristic::ordered}) : Characteristics::of({Characteristic::distinct, Characteristic::ordered});
+    if constexpr (std::is_integral_v<D>)
+    {
+        if (step > D{})
+        {
+            characteristics = characteristics.sized(end > start ? (static_cast<function::Module>(end) - static_cast<function::Module>(start) - 1) / static_cast<function::Module>(step) + 1 : 0);
+        }
+        else if (step < D{})
+        {
+            characteristics = characteristics.sized(start > end ? (static_cast<function::Module>(start) - static_cast<function::Module>(end) - 1) / (0 - static_cast<function::Module>(step)) + 1 : 0);
+        }
+        else
+        {
+            characteristics = characteristics.sized(0);
+        }
+    }
+    function::Generator<D> generator = [startValue = start, endValue = end, stepValue = step](function::BiConsumer<D, function::Timestamp> accept, function::BiPredicate<D, function::Timestamp> interrupt) -> void {
         if (stepValue == D{})
         {
             return;
@@ -1701,14 +3056,26 @@ auto useRange(const D &start, const D &end, const D &step) -> Semantic<D>
                 index++;
             }
         }
-    },
-                       1ULL);
+    };
+    if constexpr (std::is_integral_v<D>)
+    {
+        return Semantic<D>(generator, characteristics, [start, step](const function::Module &position) -> D { return static_cast<D>(start + static_cast<D>(position) * step); });
+    }
+    else
+    {
+        return Semantic<D>(generator, characteristics);
+    }
 }
 
 template <typename D>
 auto useRangeClosed(const D &start, const D &end) -> Semantic<D>
 {
-    return Semantic<D>([startValue = std::min(start, end), endValue = std::max(start, end)](function::BiConsumer<D, function::Timestamp> accept, function::BiPredicate<D, function::Timestamp> interrupt) -> void {
+    Characteristics characteristics = Characteristics::of({Characteristic::sorted, Characteristic::distinct, Characteristic::ordered});
+    if constexpr (std::is_integral_v<D>)
+    {
+        characteristics = characteristics.sized(static_cast<function::Module>(std::max(start, end)) - static_cast<function::Module>(std::min(start, end)) + 1);
+    }
+    function::Generator<D> generator = [startValue = std::min(start, end), endValue = std::max(start, end)](function::BiConsumer<D, function::Timestamp> accept, function::BiPredicate<D, function::Timestamp> interrupt) -> void {
         function::Timestamp index = 0LL;
         for (D value = startValue; value <= endValue; value++)
         {
@@ -1719,14 +3086,37 @@ auto useRangeClosed(const D &start, const D &end) -> Semantic<D>
             accept(value, index);
             index++;
         }
-    },
-                       1ULL);
+    };
+    if constexpr (std::is_integral_v<D>)
+    {
+        return Semantic<D>(generator, characteristics, [startValue = std::min(start, end)](const function::Module &position) -> D { return static_cast<D>(startValue + static_cast<D>(position)); });
+    }
+    else
+    {
+        return Semantic<D>(generator, characteristics);
+    }
 }
 
 template <typename D>
 auto useRangeClosed(const D &start, const D &end, const D &step) -> Semantic<D>
 {
-    return Semantic<D>([startValue = start, endValue = end, stepValue = step](function::BiConsumer<D, function::Timestamp> accept, function::BiPredicate<D, function::Timestamp> interrupt) -> void {
+    Characteristics characteristics = step > D{} ? Characteristics::of({Characteristic::sorted, Characteristic::distinct, Characteristic::ordered}) : Characteristics::of({Characteristic::distinct, Characteristic::ordered});
+    if constexpr (std::is_integral_v<D>)
+    {
+        if (step > D{})
+        {
+            characteristics = characteristics.sized(end >= start ? (static_cast<function::Module>(end) - static_cast<function::Module>(start)) / static_cast<function::Module>(step) + 1 : 0);
+        }
+        else if (step < D{})
+        {
+            characteristics = characteristics.sized(start >= end ? (static_cast<function::Module>(start) - static_cast<function::Module>(end)) / (0 - static_cast<function::Module>(step)) + 1 : 0);
+        }
+        else
+        {
+            characteristics = characteristics.sized(0);
+        }
+    }
+    function::Generator<D> generator = [startValue = start, endValue = end, stepValue = step](function::BiConsumer<D, function::Timestamp> accept, function::BiPredicate<D, function::Timestamp> interrupt) -> void {
         if (stepValue == D{})
         {
             return;
@@ -1756,8 +3146,15 @@ auto useRangeClosed(const D &start, const D &end, const D &step) -> Semantic<D>
                 index++;
             }
         }
-    },
-                       1ULL);
+    };
+    if constexpr (std::is_integral_v<D>)
+    {
+        return Semantic<D>(generator, characteristics, [start, step](const function::Module &position) -> D { return static_cast<D>(start + static_cast<D>(position) * step); });
+    }
+    else
+    {
+        return Semantic<D>(generator, characteristics);
+    }
 }
 
 template <typename D, typename UnaryFunc,
@@ -1975,26 +3372,30 @@ auto useRandom(const D &min, const D &max, const function::Module &count) -> Sem
 template <typename D>
 auto useEmpty() -> Semantic<D>
 {
+    Characteristics characteristics = Characteristics::of({Characteristic::sorted, Characteristic::distinct, Characteristic::ordered}).sized(0);
     return Semantic<D>([](function::BiConsumer<D, function::Timestamp> accept, function::BiPredicate<D, function::Timestamp> interrupt) -> void {
         return;
-    });
+    },
+                       characteristics);
 }
 
 template <typename D>
 auto useOf(D element) -> Semantic<D>
 {
+    Characteristics characteristics = Characteristics::of({Characteristic::sorted, Characteristic::distinct, Characteristic::ordered}).sized(1);
     return Semantic<D>([element](function::BiConsumer<D, function::Timestamp> accept, function::BiPredicate<D, function::Timestamp> interrupt) -> void {
         if (!interrupt(element, 0LL))
         {
             accept(element, 0LL);
         }
     },
-                       1LL);
+                       characteristics);
 }
 
 template <typename E>
 auto useOf(E element1, E element2) -> Semantic<E>
 {
+    Characteristics characteristics = Characteristics::of({Characteristic::ordered}).sized(2);
     return Semantic<E>([element1, element2](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
         if (!interrupt(element1, 0LL))
         {
@@ -2005,12 +3406,13 @@ auto useOf(E element1, E element2) -> Semantic<E>
             accept(element2, 1LL);
         }
     },
-                       1LL);
+                       characteristics);
 }
 
 template <typename E>
 auto useOf(E element1, E element2, E element3) -> Semantic<E>
 {
+    Characteristics characteristics = Characteristics::of({Characteristic::ordered}).sized(3);
     return Semantic<E>([element1, element2, element3](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
         if (!interrupt(element1, 0LL))
         {
@@ -2025,34 +3427,58 @@ auto useOf(E element1, E element2, E element3) -> Semantic<E>
             accept(element3, 2LL);
         }
     },
-                       1LL);
+                       characteristics);
 }
 
 template <typename Container>
 auto useFrom(Container container) -> Semantic<typename Container::value_type>
 {
+    Characteristics characteristics = Characteristics::of({Characteristic::ordered}).sized(static_cast<function::Module>(std::distance(std::begin(container), std::end(container))));
     using E = typename Container::value_type;
-    return Semantic<E>([elements = std::forward<Container>(container)](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
-        function::Timestamp index = 0LL;
-        for (const E &element : elements)
-        {
-            if (interrupt(element, index))
+    using Category = typename std::iterator_traits<decltype(std::begin(container))>::iterator_category;
+    if constexpr (std::is_base_of_v<std::random_access_iterator_tag, Category>)
+    {
+        std::shared_ptr<const Container> elements = std::make_shared<const Container>(std::forward<Container>(container));
+        return Semantic<E>([elements](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
+            function::Timestamp index = 0LL;
+            for (const E &element : *elements)
             {
-                break;
+                if (interrupt(element, index))
+                {
+                    break;
+                }
+                accept(element, index);
+                index++;
             }
-            accept(element, index);
-            index++;
-        }
-    },
-                       1LL);
+        },
+                           characteristics, [elements](const function::Module &position) -> E { return *(std::begin(*elements) + position); });
+    }
+    else
+    {
+        return Semantic<E>([elements = std::forward<Container>(container)](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
+            function::Timestamp index = 0LL;
+            for (const E &element : elements)
+            {
+                if (interrupt(element, index))
+                {
+                    break;
+                }
+                accept(element, index);
+                index++;
+            }
+        },
+                           characteristics);
+    }
 }
 
 template <typename E>
 auto useFrom(std::initializer_list<E> list) -> Semantic<E>
 {
-    return Semantic<E>([elements = std::vector<E>(list)](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
+    Characteristics characteristics = Characteristics::of({Characteristic::ordered}).sized(list.size());
+    std::shared_ptr<const std::vector<E>> elements = std::make_shared<const std::vector<E>>(list);
+    return Semantic<E>([elements](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
         function::Timestamp index = 0LL;
-        for (const E &element : elements)
+        for (const E &element : *elements)
         {
             if (interrupt(element, index))
             {
@@ -2062,12 +3488,13 @@ auto useFrom(std::initializer_list<E> list) -> Semantic<E>
             index++;
         }
     },
-                       1LL);
+                       characteristics, [elements](const function::Module &position) -> E { return (*elements)[position]; });
 }
 
 template <typename E>
 auto useOf(std::initializer_list<E> elements) -> Semantic<E>
 {
+    Characteristics characteristics = Characteristics::of({Characteristic::ordered}).sized(elements.size());
     return Semantic<E>([elements = std::vector<E>(elements)](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
         function::Timestamp index = 0LL;
         for (const E &element : elements)
@@ -2080,12 +3507,13 @@ auto useOf(std::initializer_list<E> elements) -> Semantic<E>
             index++;
         }
     },
-                       1LL);
+                       characteristics);
 }
 
 template <typename E>
 auto useRepeat(const E &element, const function::Module &count) -> Semantic<E>
 {
+    Characteristics characteristics = (count <= 1 ? Characteristics::of({Characteristic::sorted, Characteristic::distinct, Characteristic::ordered}) : Characteristics::of({Characteristic::sorted, Characteristic::ordered})).sized(count);
     return Semantic<E>([element, count](function::BiConsumer<E, function::Timestamp> accept, function::BiPredicate<E, function::Timestamp> interrupt) -> void {
         for (function::Timestamp index = 0LL; index < count; index++)
         {
@@ -2095,14 +3523,17 @@ auto useRepeat(const E &element, const function::Module &count) -> Semantic<E>
             }
             accept(element, index);
         }
-    });
+    },
+                       characteristics, [element](const function::Module &) -> E { return element; });
 }
 
 auto useBlob(const std::string &text) -> Semantic<char>
 {
-    return Semantic<char>([text](function::BiConsumer<char, function::Timestamp> accept, function::BiPredicate<char, function::Timestamp> interrupt) -> void {
+    Characteristics characteristics = Characteristics::of({Characteristic::ordered}).sized(text.size());
+    std::shared_ptr<const std::string> bytes = std::make_shared<const std::string>(text);
+    return Semantic<char>([bytes](function::BiConsumer<char, function::Timestamp> accept, function::BiPredicate<char, function::Timestamp> interrupt) -> void {
         function::Timestamp index = 0LL;
-        for (const auto &byte : text)
+        for (const auto &byte : *bytes)
         {
             if (interrupt(byte, index))
             {
@@ -2112,29 +3543,31 @@ auto useBlob(const std::string &text) -> Semantic<char>
             index++;
         }
     },
-                          1LL);
+                          characteristics, [bytes](const function::Module &position) -> char { return (*bytes)[position]; });
 }
 
 auto useBlob(const std::string &text, function::Module start, const function::Module end) -> Semantic<char>
 {
-    return Semantic<char>([text, start, end](function::BiConsumer<char, function::Timestamp> accept, function::BiPredicate<char, function::Timestamp> interrupt) -> void {
-        function::Module limitedStart = std::max(start, static_cast<function::Module>(0LL));
-        function::Module limitedEnd = std::min(end, static_cast<function::Module>(text.size()));
+    std::shared_ptr<const std::string> bytes = std::make_shared<const std::string>(text);
+    function::Module limitedStart = std::max(start, static_cast<function::Module>(0LL));
+    function::Module limitedEnd = std::min(end, static_cast<function::Module>(text.size()));
+    Characteristics characteristics = Characteristics::of({Characteristic::ordered}).sized(limitedStart < limitedEnd ? limitedEnd - limitedStart : 0);
+    return Semantic<char>([bytes, limitedStart, limitedEnd](function::BiConsumer<char, function::Timestamp> accept, function::BiPredicate<char, function::Timestamp> interrupt) -> void {
         if (limitedStart < limitedEnd)
         {
             function::Timestamp index = 0LL;
             for (function::Module i = limitedStart; i < limitedEnd; i++)
             {
-                if (interrupt(text[i], index))
+                if (interrupt((*bytes)[i], index))
                 {
                     break;
                 }
-                accept(text[i], index);
+                accept((*bytes)[i], index);
                 index++;
             }
         }
     },
-                          1LL);
+                          characteristics, [bytes, limitedStart](const function::Module &position) -> char { return (*bytes)[limitedStart + position]; });
 }
 
 auto useBlob(std::istream &stream) -> Semantic<std::string>